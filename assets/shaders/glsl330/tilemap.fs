@@ -0,0 +1,32 @@
+#version 330
+
+// One quad per tile layer: texture0 holds the layer's tile indices (one R8 texel
+// per tile), each fragment finds its cell and samples that tile from the tileset strip
+
+in vec2 fragTexCoord;
+in vec4 fragColor;
+
+uniform sampler2D texture0;     // tile indices, 255 = empty cell
+uniform sampler2D tileset;      // horizontal strip, tile i at x = i * tileSize
+uniform float tileSize;         // tile size in tileset pixels
+uniform vec4 colDiffuse;
+
+out vec4 finalColor;
+
+void main()
+{
+    vec2 layerSize = vec2(textureSize(texture0, 0));
+    vec2 tileCoord = fragTexCoord*layerSize;
+    vec2 cell = min(floor(tileCoord), layerSize - 1.0);
+
+    float index = floor(texture(texture0, (cell + 0.5)/layerSize).r*255.0 + 0.5);
+    if (index > 254.0) discard;
+
+    vec2 tilesetSize = vec2(textureSize(tileset, 0));
+    vec2 texel = (vec2(index, 0.0) + (tileCoord - cell))*tileSize;
+
+    vec4 color = texture(tileset, texel/tilesetSize);
+    if (color.a == 0.0) discard;
+
+    finalColor = color*colDiffuse*fragColor;
+}
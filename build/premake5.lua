@@ -14,6 +14,12 @@ newoption
     default = "opengl33"
 }
 
+newoption
+{
+    trigger = "profiler",
+    description = "keep the profiler overlay and --trace capture in Release builds (playtest builds)"
+}
+
 function download_progress(total, current)
     local ratio = current / total;
     ratio = math.min(math.max(ratio, 0), 1);
@@ -86,6 +92,36 @@ function platform_defines()
     filter{}
 end
 
+-- headers, defines and system libraries for an executable that links the raylib project
+function link_raylib()
+    links {"raylib"}
+
+    includedirs {raylib_dir .. "/src" }
+    includedirs {raylib_dir .."/src/external" }
+    includedirs { raylib_dir .."/src/external/glfw/include" }
+    platform_defines()
+
+    filter "action:vs*"
+        defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
+        dependson {"raylib"}
+        links {"raylib.lib"}
+        characterset ("Unicode")
+        buildoptions { "/Zc:__cplusplus" }
+
+    filter "system:windows"
+        defines{"_WIN32"}
+        links {"winmm", "gdi32", "opengl32"}
+        libdirs {"../bin/%{cfg.buildcfg}"}
+
+    filter "system:linux"
+        links {"pthread", "m", "dl", "rt", "X11"}
+
+    filter "system:macosx"
+        links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
+
+    filter{}
+end
+
 -- if you don't want to download raylib, then set this to false, and set the raylib dir to where you want raylib to be pulled from, must be full sources.
 downloadRaylib = true
 raylib_dir = "external/raylib-master"
@@ -121,6 +157,9 @@ workspace (workspaceName)
         defines { "NDEBUG" }
         optimize "On"
 
+    filter "options:profiler"
+        defines { "PROFILER_ENABLED=1" }
+
     filter { "platforms:x64" }
         architecture "x86_64"
 
@@ -172,37 +211,72 @@ if (downloadRaylib) then
         includedirs { "../src" }
         includedirs { "../include" }
 
-        links {"raylib"}
-
         cdialect "C17"
         cppdialect "C++17"
 
-        includedirs {raylib_dir .. "/src" }
-        includedirs {raylib_dir .."/src/external" }
-        includedirs { raylib_dir .."/src/external/glfw/include" }
         flags { "ShadowedVariables"}
-        platform_defines()
+        link_raylib()
+        
+
+    -- offline level compiler, turns levels/*.map into assets/levels/*.lvl (no raylib needed)
+    project "levelc"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        files {"../tools/levelc/**.c", "../tools/levelc/**.h", "../src/level_format.h"}
+        includedirs { "../src", "../tools/levelc" }
+
+        language "C"
+        cdialect "C17"
 
         filter "action:vs*"
-            defines{"_WINSOCK_DEPRECATED_NO_WARNINGS", "_CRT_SECURE_NO_WARNINGS"}
-            dependson {"raylib"}
-            links {"raylib.lib"}
-            characterset ("Unicode")
-            buildoptions { "/Zc:__cplusplus" }
+            defines{"_CRT_SECURE_NO_WARNINGS"}
+            debugdir "$(SolutionDir)"
+
+        filter{}
+
+    -- asset packer, turns assets/ into assets.pak for the game to map at startup
+    -- (bin/<config>/pak assets assets.pak, run from the repo root)
+    project "pak"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
 
-        filter "system:windows"
-            defines{"_WIN32"}
-            links {"winmm", "gdi32", "opengl32"}
-            libdirs {"../bin/%{cfg.buildcfg}"}
+        files {"../tools/pak/**.c", "../src/pak_format.h"}
+        includedirs { "../src" }
 
-        filter "system:linux"
-            links {"pthread", "m", "dl", "rt", "X11"}
+        language "C"
+        cdialect "C17"
 
-        filter "system:macosx"
-            links {"OpenGL.framework", "Cocoa.framework", "IOKit.framework", "CoreFoundation.framework", "CoreAudio.framework", "CoreVideo.framework", "AudioToolbox.framework"}
+        filter "action:vs*"
+            defines{"_CRT_SECURE_NO_WARNINGS"}
+            debugdir "$(SolutionDir)"
+
+        filter{}
+
+    -- scripted benchmark scenes, prints ns/frame per profiler zone as CSV or JSON
+    -- (bin/<config>/bench --format json --out before.json, run from the repo root)
+    project "bench"
+        kind "ConsoleApp"
+        location "build_files/"
+        targetdir "../bin/%{cfg.buildcfg}"
+
+        files {"../tools/bench/**.c", "../src/**.c", "../src/**.h", "../tools/levelc/level_writer.c", "../tools/levelc/level_writer.h"}
+        removefiles {"../src/main.c"}
+        includedirs { "../src", "../tools/levelc" }
+
+        -- zones are the measurement, keep them in Release too
+        defines { "PROFILER_ENABLED=1" }
+
+        language "C"
+        cdialect "C17"
+        link_raylib()
+
+        filter "action:vs*"
+            debugdir "$(SolutionDir)"
 
         filter{}
-        
 
     project "raylib"
         kind "StaticLib"
@@ -90,6 +90,38 @@ extern "C" {            // Prevents name mangling of functions
         return false;
     }
 
+    /// <summary>
+    /// Looks for the specified file in the same locations as SearchAndSetResourceDir
+    /// </summary>
+    /// <param name="fileName">The name of the file to look for</param>
+    /// <returns>The path of the file if found (valid until the next call), NULL otherwise</returns>
+    inline static const char* SearchResourceFile(const char* fileName)
+    {
+        static char found[1024];
+
+        // check the working dir
+        if (FileExists(fileName))
+        {
+            TextCopy(found, fileName);
+            return found;
+        }
+
+        // check the applicationDir and up to three levels above it
+        const char* appDir = GetApplicationDirectory();
+        const char* ups[] = { "", "../", "../../", "../../../" };
+        for (int i = 0; i < 4; i++)
+        {
+            const char* path = TextFormat("%s%s%s", appDir, ups[i], fileName);
+            if (FileExists(path))
+            {
+                TextCopy(found, path);
+                return found;
+            }
+        }
+
+        return NULL;
+    }
+
 #if defined(__cplusplus)
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,155 @@
+#include "animation.h"
+
+void boss_awake_animation(Animation* anim) {
+    anim->row = 1;
+    anim->first_frame = 0;
+    anim->last_frame = 3;
+    anim->current_frame = 0;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+}
+
+void boss_sleep_animation(Animation* anim) {
+    anim->row = 0;
+    anim->first_frame = 0;
+    anim->last_frame = 3;
+    anim->current_frame = 0;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+}
+
+void animation_update(Animation* self, float dt) {
+    self->duration_left -= dt;
+    if (self->duration_left <= 0.0f) {
+        self->duration_left = self->speed;
+        switch (self->type) {
+            case LOOP:
+                if (self->current_frame >= self->last_frame)
+                    self->current_frame = self->first_frame;
+                else
+                    self->current_frame += 1;
+                break;
+            case ONESHOT:
+                if (self->current_frame < self->last_frame)
+                    self->current_frame += 1;
+                break;
+        }
+    }
+}
+
+Rectangle animation_frame(Animation* self, int max_frames, int num_rows, Texture2D texture) {
+    float frame_width = (float)texture.width / max_frames;
+    float frame_height = (float)texture.height / num_rows;
+    float x = (self->current_frame % max_frames) * frame_width;
+    float y = self->row * frame_height;
+    return (Rectangle){x, y, frame_width, frame_height};
+}
+
+SheetFrame animation_sheet_frame(const Animation* self, const SpriteSheet* sheet) {
+    int index = self->row * sheet->columns + self->current_frame % sheet->columns;
+    if (index < 0 || index >= sheet->columns * sheet->rows) return (SheetFrame){0};
+    return sheet->frames[index];
+}
+
+
+void select_player_animation(bool moving, bool jumping, Animation* anim) {
+    int prev_row = anim->row;
+    AnimationType prev_type = anim->type;
+
+    if (jumping) {
+        anim->first_frame = 0;
+        anim->row = 4;
+        anim->last_frame = 3;
+        anim->type = LOOP;
+        
+    } else if (moving) {
+        anim->row = 1;
+        anim->first_frame = 0;
+        anim->last_frame = 7;
+        anim->type = LOOP;
+    } else {
+        anim->row = 0;
+        anim->first_frame = 0;
+        anim->last_frame = 7;
+        anim->type = LOOP;
+    }
+
+    // Reset current_frame if animation row or type changed
+    if (anim->row != prev_row || anim->type != prev_type) {
+        anim->current_frame = 0;
+        anim->duration_left = anim->speed;
+    }
+}
+
+
+//=============================== Animation Functions ===================================//
+
+void death_animation(Animation* anim) {
+    anim->row = 7;
+    anim->first_frame = 0;
+    anim->last_frame = 13;
+    anim->current_frame = 0;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+}
+
+void player_attack_animation1(Animation* anim) {
+    anim->row = 2;
+    anim->first_frame = 0;
+    anim->last_frame = 3;
+    anim->current_frame = 0;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+
+}
+void player_attack_animation2(Animation* anim) {
+    anim->row = 3;
+    anim->first_frame = 0;
+    anim->last_frame = 2;
+    anim->current_frame = 0;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+}
+void idle_animation(Animation* anim) {
+    
+    anim->row = 0;
+    anim->first_frame = 0;
+    anim->last_frame = 7;
+    anim->current_frame = 0;
+    anim->type = LOOP;
+    anim->duration_left = anim->speed;
+    
+}
+
+void hit_animation(Animation* anim) {
+    anim->row = 6;
+    anim->first_frame = 1;
+    anim->last_frame = 1;
+    anim->current_frame = 1;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+}
+void mob_attack_animation1(Animation* anim) {
+    anim->row = 3;
+    anim->first_frame = 0;
+    anim->last_frame = 9;
+    anim->current_frame = 0;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+}
+void mob_attack_animation2(Animation* anim) {
+    anim->row = 3;
+    anim->first_frame = 0;
+    anim->last_frame = 9;
+    anim->current_frame = 0;
+    anim->type = ONESHOT;
+    anim->duration_left = anim->speed;
+}
+void mob_idle_animation(Animation* anim) {
+    anim->row = 0;
+    anim->first_frame = 0;
+    anim->last_frame = 9;
+    anim->current_frame = 0;
+    anim->type = LOOP;
+    anim->duration_left = anim->speed;
+}
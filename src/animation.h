@@ -0,0 +1,34 @@
+#pragma once
+
+#include "raylib.h"
+#include "sprite_sheet.h"
+#include <stdbool.h>
+
+typedef enum AnimationType { LOOP = 1, ONESHOT = 2 } AnimationType;
+
+typedef struct Animation {
+    int first_frame;
+    int last_frame;
+    int current_frame;
+    float speed;
+    float duration_left;
+    int row;
+    AnimationType type;
+} Animation;
+
+void animation_update(Animation* self, float dt);
+Rectangle animation_frame(Animation* self, int max_frames, int num_rows, Texture2D texture);
+// Trimmed source rect and its offset in the cell, for DrawSheetFrame
+SheetFrame animation_sheet_frame(const Animation* self, const SpriteSheet* sheet);
+void select_player_animation(bool moving, bool jumping, Animation* anim);
+
+void boss_awake_animation(Animation* anim);
+void boss_sleep_animation(Animation* anim);
+void death_animation(Animation* anim);
+void player_attack_animation1(Animation* anim);
+void player_attack_animation2(Animation* anim);
+void idle_animation(Animation* anim);
+void hit_animation(Animation* anim);
+void mob_attack_animation1(Animation* anim);
+void mob_attack_animation2(Animation* anim);
+void mob_idle_animation(Animation* anim);
@@ -0,0 +1,195 @@
+#include "asset_loader.h"
+#include "jobs.h"
+#include "pak.h"
+#include "profiler.h"
+#include "texture_cache.h"
+#include <string.h>
+
+bool InitAssetLoader(AssetLoader* loader) {
+    memset(loader, 0, sizeof(*loader));
+    loader->mutex = NewMutex();
+    loader->decoded = NewCond();
+    if (!loader->mutex || !loader->decoded) {
+        FreeCond(loader->decoded);
+        FreeMutex(loader->mutex);
+        return false;
+    }
+    loader->startTime = GetTraceTime();
+    return true;
+}
+
+// Blocks until no worker holds a load
+static void WaitForDecodes(AssetLoader* loader) {
+    LockMutex(loader->mutex);
+    for (int i = 0; i < loader->count; i++) {
+        while (loader->loads[i].state == ASSET_LOAD_DECODING) WaitCond(loader->decoded, loader->mutex);
+    }
+    UnlockMutex(loader->mutex);
+}
+
+void UnloadAssetLoader(AssetLoader* loader) {
+    WaitForDecodes(loader);
+    for (int i = 0; i < loader->count; i++) {
+        AssetLoad* load = &loader->loads[i];
+        if (load->state != ASSET_LOAD_DECODED) continue;
+        UnloadImage(load->image);
+        UnloadWave(load->wave);
+    }
+    FreeCond(loader->decoded);
+    FreeMutex(loader->mutex);
+    memset(loader, 0, sizeof(*loader));
+}
+
+static void QueueLoad(AssetLoader* loader, AssetType type, void* target, const char* path) {
+    if (loader->count == MAX_ASSET_LOADS) {
+        TraceLog(LOG_WARNING, "ASSETS: [%s] not loaded, more than %d loads queued", path, MAX_ASSET_LOADS);
+        return;
+    }
+    loader->loads[loader->count++] = (AssetLoad){
+        .type = type,
+        .path = path,
+        .target = target,
+        .state = ASSET_LOAD_QUEUED,
+        .loader = loader
+    };
+}
+
+void QueueImageLoad(AssetLoader* loader, Image* image, const char* path) {
+    memset(image, 0, sizeof(*image));
+    QueueLoad(loader, ASSET_IMAGE, image, path);
+}
+
+void QueueTextureLoad(AssetLoader* loader, Texture2D* texture, const char* path) {
+    memset(texture, 0, sizeof(*texture));
+    QueueLoad(loader, ASSET_TEXTURE, texture, path);
+}
+
+void QueueSoundLoad(AssetLoader* loader, Sound* sound, const char* path) {
+    memset(sound, 0, sizeof(*sound));
+    QueueLoad(loader, ASSET_SOUND, sound, path);
+}
+
+// Worker side: file read and decompression only. raylib's image and wave loaders
+// touch no GL or audio state, so they are safe off the main thread.
+static void DecodeAsset(void* data) {
+    AssetLoad* load = data;
+    double start = GetTraceTime();
+    TRACE_BEGIN(load->path);
+
+    if (load->type == ASSET_SOUND) {
+        load->wave = LoadWaveAsset(load->path);
+        load->failed = load->wave.data == NULL;
+    }
+    else {
+        load->image = LoadImageAsset(load->path);
+        load->failed = load->image.data == NULL;
+    }
+
+    TRACE_END(load->path);
+    load->decodeSeconds = GetTraceTime() - start;
+
+    AssetLoader* loader = load->loader;
+    LockMutex(loader->mutex);
+    load->state = ASSET_LOAD_DECODED;
+    SignalCond(loader->decoded);
+    UnlockMutex(loader->mutex);
+}
+
+void StartAssetLoads(AssetLoader* loader) {
+    for (int i = 0; i < loader->count; i++) {
+        AssetLoad* load = &loader->loads[i];
+        if (load->state != ASSET_LOAD_QUEUED) continue;
+        load->state = ASSET_LOAD_DECODING;
+        PushJob(DecodeAsset, load);
+    }
+}
+
+// Main thread side: everything that needs the GL context or the audio device
+static void FinishAsset(AssetLoad* load) {
+    double start = GetTraceTime();
+    TRACE_BEGIN(load->path);
+
+    if (!load->failed) {
+        switch (load->type) {
+            case ASSET_IMAGE:
+                *(Image*)load->target = load->image;
+                break;
+            case ASSET_TEXTURE:
+                *(Texture2D*)load->target = LoadTextureFromImage(load->image);
+                UnloadImage(load->image);
+                break;
+            case ASSET_SOUND:
+                *(Sound*)load->target = LoadSoundFromWave(load->wave);
+                UnloadWave(load->wave);
+                break;
+        }
+    }
+    load->image = (Image){0};
+    load->wave = (Wave){0};
+
+    TRACE_END(load->path);
+    load->uploadSeconds = GetTraceTime() - start;
+    load->state = ASSET_LOAD_DONE;
+}
+
+bool UpdateAssetLoader(AssetLoader* loader, double budgetSeconds) {
+    double start = GetTraceTime();
+    bool finishedOne = false;
+
+    for (int i = 0; i < loader->count; i++) {
+        AssetLoad* load = &loader->loads[i];
+
+        LockMutex(loader->mutex);
+        bool ready = load->state == ASSET_LOAD_DECODED;
+        UnlockMutex(loader->mutex);
+        if (!ready) continue;
+
+        if (finishedOne && GetTraceTime() - start >= budgetSeconds) break;
+        FinishAsset(load);
+        finishedOne = true;
+        loader->done++;
+    }
+
+    if (loader->done == loader->count && loader->finishTime == 0.0) loader->finishTime = GetTraceTime();
+    return loader->done == loader->count;
+}
+
+float GetAssetLoadProgress(const AssetLoader* loader) {
+    return loader->count > 0 ? (float)loader->done / loader->count : 1.0f;
+}
+
+void LogAssetLoadTimes(const AssetLoader* loader) {
+    double decodeTotal = 0.0;
+    double uploadTotal = 0.0;
+    for (int i = 0; i < loader->count; i++) {
+        const AssetLoad* load = &loader->loads[i];
+        TraceLog(LOG_INFO, "ASSETS: %-40s decode %7.2f ms  upload %6.2f ms%s", load->path,
+            load->decodeSeconds * 1e3, load->uploadSeconds * 1e3, load->failed ? "  FAILED" : "");
+        decodeTotal += load->decodeSeconds;
+        uploadTotal += load->uploadSeconds;
+    }
+
+    double wall = (loader->finishTime > 0.0 ? loader->finishTime : GetTraceTime()) - loader->startTime;
+    TraceLog(LOG_INFO, "ASSETS: %d loads in %.2f ms on %d workers (%.2f ms decoding, %.2f ms uploading)",
+        loader->count, wall * 1e3, GetJobWorkerCount(), decodeTotal * 1e3, uploadTotal * 1e3);
+}
+
+Image LoadImageAsset(const char* path) {
+    uint32_t size = 0;
+    const void* data = FindPakFile(path, &size);
+    if (data) return LoadImageCached(GetFileExtension(path), data, size);
+
+    int fileSize = 0;
+    unsigned char* fileData = LoadFileData(path, &fileSize);
+    if (!fileData) return (Image){0};
+    Image image = LoadImageCached(GetFileExtension(path), fileData, (uint32_t)fileSize);
+    UnloadFileData(fileData);
+    return image;
+}
+
+Wave LoadWaveAsset(const char* path) {
+    uint32_t size = 0;
+    const void* data = FindPakFile(path, &size);
+    if (!data) return LoadWave(path);
+    return LoadWaveFromMemory(GetFileExtension(path), data, (int)size);
+}
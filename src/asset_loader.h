@@ -0,0 +1,83 @@
+#pragma once
+
+#include "raylib.h"
+#include "thread.h"
+#include <stdbool.h>
+
+// Decodes images and audio on the job workers (jobs.h) and finishes them on the main
+// thread, where the GL context and audio device live: texture uploads and sound
+// creation run from UpdateAssetLoader under a per-call time budget, so a loading
+// screen keeps drawing while the files come in.
+
+#define MAX_ASSET_LOADS 64
+#define ASSET_UPLOAD_BUDGET (4.0 / 1000.0)  // seconds of main-thread finishing per loading screen frame
+
+typedef enum AssetType {
+    ASSET_IMAGE = 0,    // decoded only, stays in RAM for the caller to process
+    ASSET_TEXTURE,
+    ASSET_SOUND
+} AssetType;
+
+typedef enum AssetLoadState {
+    ASSET_LOAD_QUEUED = 0,
+    ASSET_LOAD_DECODING,    // owned by a worker
+    ASSET_LOAD_DECODED,     // waiting for the main thread
+    ASSET_LOAD_DONE
+} AssetLoadState;
+
+typedef struct AssetLoad {
+    AssetType type;
+    const char* path;       // stored by pointer, must outlive the load
+    void* target;           // Image*, Texture2D* or Sound*, written when the load is done
+    AssetLoadState state;   // DECODING -> DECODED happens under the loader mutex
+
+    Image image;            // worker output
+    Wave wave;
+    bool failed;
+
+    double decodeSeconds;   // file read + decompression, on a worker
+    double uploadSeconds;   // GPU upload or sound creation, on the main thread
+
+    struct AssetLoader* loader;
+} AssetLoad;
+
+typedef struct AssetLoader {
+    AssetLoad loads[MAX_ASSET_LOADS];
+    int count;
+    int done;
+
+    ThreadMutex* mutex;
+    ThreadCond* decoded;    // a worker finished a decode
+    double startTime;
+    double finishTime;
+} AssetLoader;
+
+bool InitAssetLoader(AssetLoader* loader);
+
+// Frees whatever was decoded but never finished, after waiting for in-flight decodes
+void UnloadAssetLoader(AssetLoader* loader);
+
+// Targets are zeroed right away and filled in once the load is done.
+// A failed load leaves its target zeroed (id 0 / data NULL).
+void QueueImageLoad(AssetLoader* loader, Image* image, const char* path);
+void QueueTextureLoad(AssetLoader* loader, Texture2D* texture, const char* path);
+void QueueSoundLoad(AssetLoader* loader, Sound* sound, const char* path);
+
+// Hands every queued load to the job workers
+void StartAssetLoads(AssetLoader* loader);
+
+// Main thread only. Finishes decoded loads until budgetSeconds is spent (at least one
+// per call), returns true once every queued load is done.
+bool UpdateAssetLoader(AssetLoader* loader, double budgetSeconds);
+
+// Fraction of queued loads that are done, for a progress bar
+float GetAssetLoadProgress(const AssetLoader* loader);
+
+// One line per asset with its decode and upload times, plus the wall time of the batch
+void LogAssetLoadTimes(const AssetLoader* loader);
+
+// LoadImage / LoadWave that decode straight out of the mounted archive (pak.h) and
+// only open the loose file when the archive is missing or lacks the path. Images go
+// through the decoded pixel cache (texture_cache.h). Safe on the job workers.
+Image LoadImageAsset(const char* path);
+Wave LoadWaveAsset(const char* path);
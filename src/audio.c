@@ -0,0 +1,160 @@
+#include "audio.h"
+#include "pak.h"
+#include "resource_manager.h"
+#include <string.h>
+
+typedef struct SfxInfo {
+    const char* path;
+    int voices;             // how many copies can overlap
+    SfxPriority priority;
+} SfxInfo;
+
+static const SfxInfo sfxInfo[SFX_COUNT] = {
+    [SFX_AWAKE] = { "assets/sound/awake_fx.mp3", 2, SFX_PRIORITY_HIGH },
+};
+
+// An alias shares its effect's decoded samples and only adds a playback cursor
+typedef struct AudioVoice {
+    Sound sound;
+    SfxPriority priority;
+    unsigned int startOrder;    // when it last started, lowest is oldest
+    bool playing;
+} AudioVoice;
+
+static struct {
+    Sound sources[SFX_COUNT];
+    ResourceHandle handles[SFX_COUNT];     // sources are owned by the resource manager once started
+    AudioVoice voices[AUDIO_MAX_VOICES];
+    int firstVoice[SFX_COUNT];
+    int voiceCount[SFX_COUNT];
+    int playingCount;
+    unsigned int playOrder;
+    bool started;
+
+    Music music;
+    bool musicLoaded;
+} audio;
+
+void QueueSfxLoads(AssetLoader* loader) {
+    for (int i = 0; i < SFX_COUNT; i++) QueueSoundLoad(loader, &audio.sources[i], sfxInfo[i].path);
+}
+
+void StartAudioMixer(void) {
+    int used = 0;
+    for (int i = 0; i < SFX_COUNT; i++) {
+        audio.firstVoice[i] = used;
+        audio.voiceCount[i] = 0;
+        if (audio.sources[i].frameCount == 0) continue;   // failed load, stays silent
+        audio.handles[i] = AdoptSound(sfxInfo[i].path, audio.sources[i]);
+
+        for (int v = 0; v < sfxInfo[i].voices && used < AUDIO_MAX_VOICES; v++, used++) {
+            audio.voices[used] = (AudioVoice){ LoadSoundAlias(audio.sources[i]), sfxInfo[i].priority, 0, false };
+            audio.voiceCount[i]++;
+        }
+        if (audio.voiceCount[i] < sfxInfo[i].voices) {
+            TraceLog(LOG_WARNING, "AUDIO: voice pool full, %s gets %d of %d voices", sfxInfo[i].path, audio.voiceCount[i], sfxInfo[i].voices);
+        }
+    }
+    audio.started = true;
+    TraceLog(LOG_INFO, "AUDIO: %d effects, %d voices, %d mixed at once", SFX_COUNT, used, AUDIO_MAX_PLAYING);
+}
+
+void StopAudioMixer(void) {
+    StopMusic();
+    for (int i = 0; i < SFX_COUNT; i++) {
+        for (int v = 0; v < audio.voiceCount[i]; v++) UnloadSoundAlias(audio.voices[audio.firstVoice[i] + v].sound);
+        if (IsResourceValid(audio.handles[i])) ReleaseResource(audio.handles[i]);
+        else UnloadSound(audio.sources[i]);
+    }
+    memset(&audio, 0, sizeof(audio));
+}
+
+static void SilenceVoice(AudioVoice* voice) {
+    StopSound(voice->sound);
+    voice->playing = false;
+    audio.playingCount--;
+}
+
+// Oldest playing voice among the lowest priority ones, if that priority is <= the given one
+static AudioVoice* FindVictim(SfxPriority priority) {
+    AudioVoice* victim = NULL;
+    for (int i = 0; i < SFX_COUNT; i++) {
+        for (int v = 0; v < audio.voiceCount[i]; v++) {
+            AudioVoice* voice = &audio.voices[audio.firstVoice[i] + v];
+            if (!voice->playing || voice->priority > priority) continue;
+            if (!victim || voice->priority < victim->priority ||
+                (voice->priority == victim->priority && voice->startOrder < victim->startOrder)) {
+                victim = voice;
+            }
+        }
+    }
+    return victim;
+}
+
+void PlaySfx(SfxId sfx) {
+    if (!audio.started || audio.voiceCount[sfx] == 0) return;
+
+    // a free voice of this effect, otherwise its own oldest one restarts
+    AudioVoice* voice = NULL;
+    for (int v = 0; v < audio.voiceCount[sfx]; v++) {
+        AudioVoice* candidate = &audio.voices[audio.firstVoice[sfx] + v];
+        if (!candidate->playing) {
+            voice = candidate;
+            break;
+        }
+        if (!voice || candidate->startOrder < voice->startOrder) voice = candidate;
+    }
+
+    if (voice->playing) SilenceVoice(voice);
+    else if (audio.playingCount >= AUDIO_MAX_PLAYING) {
+        AudioVoice* victim = FindVictim(voice->priority);
+        if (!victim) return;    // everything playing outranks this one
+        SilenceVoice(victim);
+    }
+
+    PlaySound(voice->sound);
+    voice->playing = true;
+    voice->startOrder = ++audio.playOrder;
+    audio.playingCount++;
+}
+
+bool PlayMusic(const char* path) {
+    StopMusic();
+
+    // streamed straight out of the mapped archive when packed, which stays mounted until exit
+    uint32_t size = 0;
+    const void* data = FindPakFile(path, &size);
+    SetAudioStreamBufferSizeDefault(MUSIC_STREAM_FRAMES);
+    if (data) audio.music = LoadMusicStreamFromMemory(GetFileExtension(path), data, (int)size);
+    else if (FileExists(path)) audio.music = LoadMusicStream(path);
+    SetAudioStreamBufferSizeDefault(0);
+
+    if (!IsMusicValid(audio.music)) {
+        TraceLog(LOG_WARNING, "AUDIO: [%s] could not be streamed", path);
+        audio.music = (Music){0};
+        return false;
+    }
+    audio.musicLoaded = true;
+    PlayMusicStream(audio.music);
+    return true;
+}
+
+void StopMusic(void) {
+    if (!audio.musicLoaded) return;
+    StopMusicStream(audio.music);
+    UnloadMusicStream(audio.music);
+    audio.music = (Music){0};
+    audio.musicLoaded = false;
+}
+
+void UpdateAudio(void) {
+    if (audio.musicLoaded) UpdateMusicStream(audio.music);
+
+    for (int i = 0; i < AUDIO_MAX_VOICES; i++) {
+        AudioVoice* voice = &audio.voices[i];
+        if (voice->playing && !IsSoundPlaying(voice->sound)) {
+            voice->playing = false;
+            audio.playingCount--;
+        }
+    }
+}
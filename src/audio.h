@@ -0,0 +1,44 @@
+#pragma once
+
+#include "raylib.h"
+#include "asset_loader.h"
+#include <stdbool.h>
+
+// Sound effects and music. Effects are decoded once at load (QueueSfxLoads) and played
+// through a fixed pool of voices built up front, so PlaySfx never allocates or touches
+// a file: when the pool is busy, the oldest voice of equal or lower priority is cut off
+// and reused, and a sound that can't win a voice is dropped. Music streams from its
+// file (or the mounted archive) through a fixed ring buffer refilled by UpdateAudio.
+
+#define AUDIO_MAX_VOICES 32         // preallocated voices over all effects
+#define AUDIO_MAX_PLAYING 12        // effects mixed at once, the mixer's cost scales with this
+#define MUSIC_STREAM_FRAMES 8192    // ring buffer size in sample frames, ~0.19 s at 44.1 kHz
+
+typedef enum SfxId {
+    SFX_AWAKE = 0,      // the boss waking up for red light
+    SFX_COUNT
+} SfxId;
+
+typedef enum SfxPriority {
+    SFX_PRIORITY_LOW = 0,   // repeated gameplay noise, first to be cut
+    SFX_PRIORITY_NORMAL,
+    SFX_PRIORITY_HIGH       // cues the player must hear
+} SfxPriority;
+
+// Queues every effect's decode on the loader, call before StartAssetLoads
+void QueueSfxLoads(AssetLoader* loader);
+
+// Builds the voice pool once the loader has finished the effects
+void StartAudioMixer(void);
+
+// Stops everything and releases the effects, voices and music. Safe if never started.
+void StopAudioMixer(void);
+
+void PlaySfx(SfxId sfx);
+
+// Replaces any music playing. False, with nothing playing, when the file can't be opened.
+bool PlayMusic(const char* path);
+void StopMusic(void);
+
+// Once per frame: refills the music ring buffer and returns finished voices to the pool
+void UpdateAudio(void);
@@ -0,0 +1,151 @@
+#include "broadphase.h"
+#include <stdlib.h>
+#include <string.h>
+
+void InitBroadphase(Broadphase* broadphase) {
+    memset(broadphase, 0, sizeof(*broadphase));
+    memset(broadphase->handlerOf, -1, sizeof(broadphase->handlerOf));
+}
+
+void UnloadBroadphase(Broadphase* broadphase) {
+    free(broadphase->proxies);
+    free(broadphase->order);
+    free(broadphase->open);
+    free(broadphase->pairs);
+    memset(broadphase, 0, sizeof(*broadphase));
+}
+
+bool AddPairHandler(Broadphase* broadphase, int typeA, int typeB, PairHandler handler) {
+    if (typeA == typeB || typeA < 0 || typeB < 0 || typeA >= BROADPHASE_MAX_TYPES || typeB >= BROADPHASE_MAX_TYPES ||
+        broadphase->handlerCount == BROADPHASE_MAX_HANDLERS || broadphase->handlerOf[typeA][typeB] >= 0) {
+        return false;
+    }
+    int id = broadphase->handlerCount++;
+    broadphase->handlers[id] = handler;
+    broadphase->handlerFirstType[id] = typeA;
+    broadphase->handlerOf[typeA][typeB] = (signed char)id;
+    broadphase->handlerOf[typeB][typeA] = (signed char)id;
+    broadphase->partners[typeA] |= 1u << typeB;
+    broadphase->partners[typeB] |= 1u << typeA;
+    return true;
+}
+
+int AddProxy(Broadphase* broadphase, int type, int index, Rectangle bounds) {
+    if (broadphase->proxyCount == broadphase->proxyCapacity) {
+        int capacity = broadphase->proxyCapacity ? broadphase->proxyCapacity * 2 : 64;
+        broadphase->proxies = realloc(broadphase->proxies, sizeof(BroadphaseProxy) * capacity);
+        broadphase->order = realloc(broadphase->order, sizeof(int) * capacity);
+        broadphase->open = realloc(broadphase->open, sizeof(int) * capacity);
+        broadphase->proxyCapacity = capacity;
+    }
+    int id = broadphase->proxyCount++;
+    broadphase->proxies[id] = (BroadphaseProxy){ bounds, type, index };
+    broadphase->order[id] = id;     // sorted into place by the next pass
+    return id;
+}
+
+void MoveProxy(Broadphase* broadphase, int proxy, Rectangle bounds) {
+    broadphase->proxies[proxy].bounds = bounds;
+}
+
+void ParkProxy(Broadphase* broadphase, int proxy) {
+    // x is kept so the proxy stays near its place in the sort order
+    broadphase->proxies[proxy].bounds.width = 0.0f;
+    broadphase->proxies[proxy].bounds.height = 0.0f;
+}
+
+static bool IsParked(const BroadphaseProxy* proxy) {
+    return proxy->bounds.width <= 0.0f || proxy->bounds.height <= 0.0f;
+}
+
+static void SortOrder(Broadphase* broadphase) {
+    const BroadphaseProxy* proxies = broadphase->proxies;
+    int* order = broadphase->order;
+    for (int i = 1; i < broadphase->proxyCount; i++) {
+        int id = order[i];
+        float x = proxies[id].bounds.x;
+        int j = i - 1;
+        while (j >= 0 && proxies[order[j]].bounds.x > x) {
+            order[j + 1] = order[j];
+            j--;
+        }
+        order[j + 1] = id;
+    }
+}
+
+static void AddPair(Broadphase* broadphase, int a, int b) {
+    if (broadphase->pairCount == broadphase->pairCapacity) {
+        broadphase->pairCapacity = broadphase->pairCapacity ? broadphase->pairCapacity * 2 : 64;
+        broadphase->pairs = realloc(broadphase->pairs, sizeof(BroadphasePair) * broadphase->pairCapacity);
+    }
+    int handler = broadphase->handlerOf[broadphase->proxies[a].type][broadphase->proxies[b].type];
+    if (broadphase->proxies[a].type != broadphase->handlerFirstType[handler]) {
+        int swap = a;
+        a = b;
+        b = swap;
+    }
+    broadphase->pairs[broadphase->pairCount++] = (BroadphasePair){ handler, a, b };
+}
+
+static const Broadphase* sortingBroadphase;     // qsort has no context argument
+
+static int ComparePairs(const void* lhs, const void* rhs) {
+    const BroadphasePair* p = lhs;
+    const BroadphasePair* q = rhs;
+    if (p->handler != q->handler) return p->handler - q->handler;
+    const BroadphaseProxy* proxies = sortingBroadphase->proxies;
+    if (proxies[p->a].index != proxies[q->a].index) return proxies[p->a].index - proxies[q->a].index;
+    return proxies[p->b].index - proxies[q->b].index;
+}
+
+int UpdateBroadphase(Broadphase* broadphase, void* context) {
+    SortOrder(broadphase);
+
+    // carve the open buffer into one slice per type that pairs with anything
+    int openStart[BROADPHASE_MAX_TYPES] = {0};
+    int openCount[BROADPHASE_MAX_TYPES] = {0};
+    for (int i = 0; i < broadphase->proxyCount; i++) {
+        const BroadphaseProxy* proxy = &broadphase->proxies[i];
+        if (!IsParked(proxy) && broadphase->partners[proxy->type]) openCount[proxy->type]++;
+    }
+    for (int t = 1; t < BROADPHASE_MAX_TYPES; t++) openStart[t] = openStart[t - 1] + openCount[t - 1];
+    memset(openCount, 0, sizeof(openCount));
+
+    broadphase->pairCount = 0;
+    for (int i = 0; i < broadphase->proxyCount; i++) {
+        int id = broadphase->order[i];
+        const BroadphaseProxy* proxy = &broadphase->proxies[id];
+        unsigned int partners = broadphase->partners[proxy->type];
+        if (IsParked(proxy) || !partners) continue;
+
+        float top = proxy->bounds.y;
+        float bottom = proxy->bounds.y + proxy->bounds.height;
+        for (int t = 0; t < BROADPHASE_MAX_TYPES; t++) {
+            if (!(partners & (1u << t))) continue;
+
+            // everything still open started at or left of this proxy, so only the x
+            // extent can have run out, and once it has it stays out for the rest
+            int* open = broadphase->open + openStart[t];
+            for (int n = 0; n < openCount[t]; ) {
+                const BroadphaseProxy* other = &broadphase->proxies[open[n]];
+                if (other->bounds.x + other->bounds.width <= proxy->bounds.x) {
+                    open[n] = open[--openCount[t]];
+                    continue;
+                }
+                if (other->bounds.y < bottom && other->bounds.y + other->bounds.height > top) AddPair(broadphase, open[n], id);
+                n++;
+            }
+        }
+        broadphase->open[openStart[proxy->type] + openCount[proxy->type]++] = id;
+    }
+
+    sortingBroadphase = broadphase;
+    qsort(broadphase->pairs, broadphase->pairCount, sizeof(BroadphasePair), ComparePairs);
+    sortingBroadphase = NULL;
+
+    for (int i = 0; i < broadphase->pairCount; i++) {
+        const BroadphasePair* pair = &broadphase->pairs[i];
+        broadphase->handlers[pair->handler](context, broadphase->proxies[pair->a].index, broadphase->proxies[pair->b].index);
+    }
+    return broadphase->pairCount;
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define BROADPHASE_MAX_TYPES 32     // one bit each in partners
+#define BROADPHASE_MAX_HANDLERS 32
+
+// Sweep-and-prune over the things that move or get touched: every proxy is a box
+// tagged with a type and its owner's index. One pass per step sorts the proxies along
+// x and reports each overlapping pair whose two types have a handler. The sort is an
+// insertion sort over last step's order, close to linear when little moved, and the
+// sweep only compares a proxy against open proxies of the types it pairs with, so the
+// work follows the overlaps found rather than the number of proxies.
+
+// indexA is the owner of the proxy of the handler's first type
+typedef void (*PairHandler)(void* context, int indexA, int indexB);
+
+typedef struct BroadphaseProxy {
+    Rectangle bounds;   // zero size while parked, a parked proxy pairs with nothing
+    int type;
+    int index;          // owner's index, handed to the handler
+} BroadphaseProxy;
+
+typedef struct BroadphasePair {
+    int handler;
+    int a;              // proxy of the handler's first type
+    int b;
+} BroadphasePair;
+
+typedef struct Broadphase {
+    BroadphaseProxy* proxies;   // by id, ids are stable
+    int* order;                 // ids by bounds.x, kept between passes
+    int proxyCount;
+    int proxyCapacity;
+
+    PairHandler handlers[BROADPHASE_MAX_HANDLERS];
+    int handlerFirstType[BROADPHASE_MAX_HANDLERS];
+    int handlerCount;
+    signed char handlerOf[BROADPHASE_MAX_TYPES][BROADPHASE_MAX_TYPES];  // -1 for none, both orders
+    unsigned int partners[BROADPHASE_MAX_TYPES];    // bit per type with a handler
+
+    int* open;                  // per-type slices, proxies still open during the sweep
+    BroadphasePair* pairs;      // found by the last pass, in dispatch order
+    int pairCount;
+    int pairCapacity;
+} Broadphase;
+
+void InitBroadphase(Broadphase* broadphase);
+void UnloadBroadphase(Broadphase* broadphase);
+
+// Handlers run in the order they were added, the pairs of one handler by ascending
+// indexA then indexB. False when the types are equal, out of range or already handled.
+bool AddPairHandler(Broadphase* broadphase, int typeA, int typeB, PairHandler handler);
+
+// Returns the proxy's id
+int AddProxy(Broadphase* broadphase, int type, int index, Rectangle bounds);
+void MoveProxy(Broadphase* broadphase, int proxy, Rectangle bounds);
+void ParkProxy(Broadphase* broadphase, int proxy);
+
+// Finds the overlapping pairs, then runs their handlers. Handlers may move or park
+// proxies; that shows from the next pass on. Returns the number of pairs.
+int UpdateBroadphase(Broadphase* broadphase, void* context);
@@ -0,0 +1,194 @@
+#include "collision_grid.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+static int CellCoord(float worldPos) {
+    return (int)floorf(worldPos / COLLISION_CELL_SIZE);
+}
+
+static unsigned int CellBucket(int cx, int cy) {
+    unsigned int h = (unsigned int)cx * 73856093u ^ (unsigned int)cy * 19349663u;
+    return h & (COLLISION_BUCKETS - 1);
+}
+
+static bool IsEmptyRect(Rectangle rect) {
+    return rect.width <= 0 || rect.height <= 0;
+}
+
+typedef struct CellRange {
+    int cx0, cy0, cx1, cy1;
+} CellRange;
+
+static CellRange CellsOf(Rectangle rect) {
+    return (CellRange){
+        CellCoord(rect.x),
+        CellCoord(rect.y),
+        CellCoord(rect.x + rect.width),
+        CellCoord(rect.y + rect.height)
+    };
+}
+
+void BuildCollisionGrid(CollisionGrid* grid, const Rectangle* rects, int rectCount) {
+    memset(grid, 0, sizeof(*grid));
+    grid->rects = rects;
+    grid->rectCount = rectCount;
+
+    // pass 1: count entries per bucket
+    static int bucketCount[COLLISION_BUCKETS];
+    memset(bucketCount, 0, sizeof(bucketCount));
+    for (int i = 0; i < rectCount; i++) {
+        if (IsEmptyRect(rects[i])) continue;
+        CellRange cells = CellsOf(rects[i]);
+        for (int cy = cells.cy0; cy <= cells.cy1; cy++) {
+            for (int cx = cells.cx0; cx <= cells.cx1; cx++) {
+                bucketCount[CellBucket(cx, cy)]++;
+                grid->itemCount++;
+            }
+        }
+    }
+
+    // prefix sum into bucket offsets
+    for (int b = 0; b < COLLISION_BUCKETS; b++) {
+        grid->bucketStart[b + 1] = grid->bucketStart[b] + bucketCount[b];
+    }
+
+    // pass 2: scatter rect indices
+    grid->items = malloc(sizeof(int) * (grid->itemCount > 0 ? grid->itemCount : 1));
+    grid->queryStamp = calloc(rectCount > 0 ? rectCount : 1, sizeof(unsigned int));
+    memset(bucketCount, 0, sizeof(bucketCount));
+    for (int i = 0; i < rectCount; i++) {
+        if (IsEmptyRect(rects[i])) continue;
+        CellRange cells = CellsOf(rects[i]);
+        for (int cy = cells.cy0; cy <= cells.cy1; cy++) {
+            for (int cx = cells.cx0; cx <= cells.cx1; cx++) {
+                unsigned int b = CellBucket(cx, cy);
+                grid->items[grid->bucketStart[b] + bucketCount[b]++] = i;
+            }
+        }
+    }
+}
+
+void UnloadCollisionGrid(CollisionGrid* grid) {
+    free(grid->items);
+    free(grid->queryStamp);
+    grid->items = NULL;
+    grid->queryStamp = NULL;
+    grid->itemCount = 0;
+}
+
+int QueryCollisionGrid(CollisionGrid* grid, Rectangle area, int* out, int maxOut) {
+    int hits = 0;
+    int count = 0;
+    grid->queryId++;
+
+    CellRange cells = CellsOf(area);
+    for (int cy = cells.cy0; cy <= cells.cy1; cy++) {
+        for (int cx = cells.cx0; cx <= cells.cx1; cx++) {
+            unsigned int b = CellBucket(cx, cy);
+            for (int k = grid->bucketStart[b]; k < grid->bucketStart[b + 1]; k++) {
+                int index = grid->items[k];
+                if (grid->queryStamp[index] == grid->queryId) continue;   // hash collision or rect spanning cells
+                grid->queryStamp[index] = grid->queryId;
+
+                if (!CheckCollisionRecs(area, grid->rects[index])) continue;
+                hits++;
+
+                // buckets come in cell order, so a full buffer gives up its highest index
+                // to a lower one rather than keeping whichever rects came first
+                if (count == maxOut) {
+                    if (maxOut == 0 || out[maxOut - 1] < index) continue;
+                    count--;
+                }
+
+                // insertion sort keeps results in level order, matching the old linear scans
+                int j = count++;
+                while (j > 0 && out[j - 1] > index) {
+                    out[j] = out[j - 1];
+                    j--;
+                }
+                out[j] = index;
+            }
+        }
+    }
+
+    return hits;
+}
+
+// Entry and exit times of one axis of a moving interval [lo, hi) against [rectLo, rectHi),
+// false if the axis never overlaps. A gap or overlap under the contact epsilon enters at 0.
+static bool SweepAxis(float lo, float hi, float rectLo, float rectHi, float motion, float* entry, float* exit) {
+    if (motion == 0.0f) {
+        float overlap = fminf(hi, rectHi) - fmaxf(lo, rectLo);
+        *entry = -INFINITY;
+        *exit = INFINITY;
+        return overlap > COLLISION_CONTACT_EPSILON;
+    }
+
+    float entryGap = motion > 0.0f ? rectLo - hi : lo - rectHi;
+    float exitGap = motion > 0.0f ? rectHi - lo : hi - rectLo;
+    float speed = fabsf(motion);
+    *entry = entryGap > -COLLISION_CONTACT_EPSILON && entryGap < 0.0f ? 0.0f : entryGap / speed;
+    *exit = exitGap / speed;
+    return true;
+}
+
+#define MAX_SWEEP_SPLITS 8  // halvings before a crowded path is swept with what fits
+
+static bool SweepPath(CollisionGrid* grid, Rectangle box, Vector2 motion, SweepHit* hit, int splits) {
+    Rectangle path = {
+        fminf(box.x, box.x + motion.x),
+        fminf(box.y, box.y + motion.y),
+        box.width + fabsf(motion.x),
+        box.height + fabsf(motion.y)
+    };
+    int candidates[COLLISION_SWEEP_CANDIDATES];
+    int count = QueryCollisionGrid(grid, path, candidates, COLLISION_SWEEP_CANDIDATES);
+
+    // too many rects along the way: the first half's hit comes first, if there is one
+    if (count > COLLISION_SWEEP_CANDIDATES) {
+        if (splits < MAX_SWEEP_SPLITS) {
+            Vector2 half = { motion.x * 0.5f, motion.y * 0.5f };
+            if (SweepPath(grid, box, half, hit, splits + 1)) {
+                hit->time *= 0.5f;
+                return true;
+            }
+            Rectangle midway = { box.x + half.x, box.y + half.y, box.width, box.height };
+            if (!SweepPath(grid, midway, half, hit, splits + 1)) return false;
+            hit->time = 0.5f + hit->time * 0.5f;
+            return true;
+        }
+        TraceLog(LOG_WARNING, "COLLISION: %d rects along a short sweep, only the first %d are tested",
+            count, COLLISION_SWEEP_CANDIDATES);
+        count = COLLISION_SWEEP_CANDIDATES;
+    }
+
+    bool found = false;
+    for (int n = 0; n < count; n++) {
+        Rectangle rect = grid->rects[candidates[n]];
+
+        float overlapX = fminf(box.x + box.width, rect.x + rect.width) - fmaxf(box.x, rect.x);
+        float overlapY = fminf(box.y + box.height, rect.y + rect.height) - fmaxf(box.y, rect.y);
+        if (overlapX > COLLISION_CONTACT_EPSILON && overlapY > COLLISION_CONTACT_EPSILON) continue;
+
+        float entryX, exitX, entryY, exitY;
+        if (!SweepAxis(box.x, box.x + box.width, rect.x, rect.x + rect.width, motion.x, &entryX, &exitX)) continue;
+        if (!SweepAxis(box.y, box.y + box.height, rect.y, rect.y + rect.height, motion.y, &entryY, &exitY)) continue;
+
+        float entry = fmaxf(entryX, entryY);
+        float exit = fminf(exitX, exitY);
+        if (entry >= exit || entry < 0.0f || entry > 1.0f) continue;   // misses, grazes a corner or is out of reach
+        if (found && entry >= hit->time) continue;
+
+        found = true;
+        hit->index = candidates[n];
+        hit->time = entry;
+        hit->normal = entryX > entryY ? (Vector2){ motion.x > 0.0f ? -1.0f : 1.0f, 0.0f }
+                                      : (Vector2){ 0.0f, motion.y > 0.0f ? -1.0f : 1.0f };
+    }
+    return found;
+}
+
+bool SweepCollisionGrid(CollisionGrid* grid, Rectangle box, Vector2 motion, SweepHit* hit) {
+    return SweepPath(grid, box, motion, hit, 0);
+}
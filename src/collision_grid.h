@@ -0,0 +1,44 @@
+#pragma once
+
+#include "raylib.h"
+
+#define COLLISION_CELL_SIZE 256.0f  // world-space size (px) of one grid cell
+#define COLLISION_BUCKETS 4096      // hashed cells, must be a power of two
+#define COLLISION_SWEEP_CANDIDATES 64   // rects a single sweep's path can cross
+#define COLLISION_CONTACT_EPSILON 0.01f // gaps and overlaps this thin count as touching
+
+// Static broadphase over the level's solid rectangles.
+// Cells are hashed rather than stored densely because the overworld and the
+// boss arena are ~20000 px apart. Built once, then queried every frame.
+typedef struct CollisionGrid {
+    const Rectangle* rects;     // not owned, must outlive the grid
+    int rectCount;
+
+    int bucketStart[COLLISION_BUCKETS + 1];   // items[bucketStart[b] .. bucketStart[b+1]) live in bucket b
+    int* items;                 // rect indices, grouped by bucket
+    int itemCount;
+
+    unsigned int* queryStamp;   // per rect, last query that returned it (dedups multi-cell rects)
+    unsigned int queryId;
+} CollisionGrid;
+
+// Zero-sized rects (unused padding in fixed-size arrays) are skipped
+void BuildCollisionGrid(CollisionGrid* grid, const Rectangle* rects, int rectCount);
+void UnloadCollisionGrid(CollisionGrid* grid);
+
+// Writes the indices of rects that may overlap area into out (ascending, no duplicates).
+// Returns how many overlap, which can be more than maxOut: only the lowest maxOut
+// indices are written then, and the caller decides whether that is enough.
+int QueryCollisionGrid(CollisionGrid* grid, Rectangle area, int* out, int maxOut);
+
+typedef struct SweepHit {
+    int index;          // rect hit
+    float time;         // fraction of the motion covered before contact, 0..1
+    Vector2 normal;     // face that was hit, pointing back at the box
+} SweepHit;
+
+// First rect that a box moving by motion runs into, from one query over the path (split
+// in halves while it crosses more than COLLISION_SWEEP_CANDIDATES rects). Rects the box
+// already overlaps are skipped and left to overlap resolution; ties go to the lowest
+// index. False, with hit untouched, when the path is clear.
+bool SweepCollisionGrid(CollisionGrid* grid, Rectangle box, Vector2 motion, SweepHit* hit);
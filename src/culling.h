@@ -0,0 +1,39 @@
+#pragma once
+
+#include "raylib.h"
+
+// Per-frame tally of world objects submitted vs skipped by the visibility pass
+typedef struct CullStats {
+    int drawn;
+    int culled;
+} CullStats;
+
+// World-space rectangle seen by a camera rendering into a width x height target
+inline static Rectangle GetCameraViewRect(Camera2D camera, int width, int height)
+{
+    return (Rectangle){
+        camera.target.x - camera.offset.x / camera.zoom,
+        camera.target.y - camera.offset.y / camera.zoom,
+        width / camera.zoom,
+        height / camera.zoom
+    };
+}
+
+// True if bounds overlaps the view, and records the result in stats.
+// Negative sizes (flipped DrawTexturePro dest rects) extend left or up from x and y.
+inline static bool IsVisible(CullStats* stats, Rectangle view, Rectangle bounds)
+{
+    if (bounds.width < 0) {
+        bounds.x += bounds.width;
+        bounds.width = -bounds.width;
+    }
+    if (bounds.height < 0) {
+        bounds.y += bounds.height;
+        bounds.height = -bounds.height;
+    }
+
+    bool visible = CheckCollisionRecs(view, bounds);
+    if (visible) stats->drawn++;
+    else stats->culled++;
+    return visible;
+}
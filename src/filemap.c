@@ -0,0 +1,75 @@
+#include "filemap.h"
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+bool MapFile(FileMapping* mapping, const char* path) {
+    mapping->data = NULL;
+    mapping->size = 0;
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE section = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!section) return false;
+
+    // the view keeps the section alive, so both handles can be closed right away
+    const void* view = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(section);
+    if (!view) return false;
+
+    mapping->data = view;
+    mapping->size = (size_t)size.QuadPart;
+    return true;
+}
+
+void UnmapFile(FileMapping* mapping) {
+    if (mapping->data) UnmapViewOfFile(mapping->data);
+    mapping->data = NULL;
+    mapping->size = 0;
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+bool MapFile(FileMapping* mapping, const char* path) {
+    mapping->data = NULL;
+    mapping->size = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size == 0) {
+        close(fd);
+        return false;
+    }
+
+    // the mapping stays valid after the descriptor is closed
+    void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    mapping->data = view;
+    mapping->size = (size_t)st.st_size;
+    return true;
+}
+
+void UnmapFile(FileMapping* mapping) {
+    if (mapping->data) munmap((void*)mapping->data, mapping->size);
+    mapping->data = NULL;
+    mapping->size = 0;
+}
+
+#endif
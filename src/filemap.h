@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Read-only view of a whole file, mmap on POSIX and MapViewOfFile on Windows.
+// Kept free of raylib.h because windows.h and raylib.h cannot share a translation unit.
+typedef struct FileMapping {
+    const void* data;
+    size_t size;
+} FileMapping;
+
+bool MapFile(FileMapping* mapping, const char* path);
+void UnmapFile(FileMapping* mapping);
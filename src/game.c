@@ -0,0 +1,1266 @@
+#include "game.h"
+#include "profiler.h"
+#include "level.h"
+#include <string.h>
+#include <math.h>
+
+// xorshift32: tiny, fast and identical on every platform, unlike the C library rand()
+// behind GetRandomValue. Returns a value in [min, max] like GetRandomValue.
+static int game_random(Game* g, int min, int max) {
+    uint32_t x = g->rngState;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    g->rngState = x;
+
+    if (min > max) {
+        int tmp = max;
+        max = min;
+        min = tmp;
+    }
+    return min + (int)(x % (uint32_t)(max - min + 1));
+}
+
+// Pickups are stored per type in the level, split them back into the per-power-up arrays
+static void load_pickups(Game* g, const Level* level) {
+    for (int i = 0; i < level->pickupCount; i++) {
+        const LevelPickup* pickup = &level->pickups[i];
+        switch (pickup->type) {
+            case LEVEL_PICKUP_DOUBLE_JUMP:
+                if (g->djumpCount < DOUBLE_JUMPS) g->Djumps[g->djumpCount++] = (PowUpDjump){ pickup->rect, false };
+                break;
+            case LEVEL_PICKUP_DASH:
+                if (g->dashCount < DASHES) g->Dashes[g->dashCount++] = (PowUpDash){ pickup->rect, false };
+                break;
+            case LEVEL_PICKUP_NOCLIP:
+                if (g->noclipCount < NOCLIP) g->Noclips[g->noclipCount++] = (PowUpNoclip){ pickup->rect, false };
+                break;
+            case LEVEL_PICKUP_LEVITATION:
+                if (g->levitationCount < LEVITATION) g->Levitations[g->levitationCount++] = (PowUpLevitation){ pickup->rect, false };
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+//================================== Contacts ==================================//
+
+// What the pair handlers work with. playing is whether the player section of the step
+// ran, the same gate the brute-force loops used to sit behind.
+typedef struct ContactContext {
+    Game* g;
+    const InputFrame* input;
+    bool playing;
+} ContactContext;
+
+static Rectangle attack_box(const Game* g) {
+    //an attack box larger than player hitbox
+    Rectangle attackBox = g->player.rect;
+    attackBox.width += 20.00f;
+    return attackBox;
+}
+
+static Vector2 brain_center(const Game* g) {
+    return (Vector2){ g->brain.position.x + g->brain.position.width / 2, g->brain.position.y + g->brain.position.height / 2 };
+}
+
+// Box around a circle, a pixel wider: raylib's circle tests count touching as a hit
+static Rectangle circle_bounds(Vector2 center, float radius) {
+    return (Rectangle){ center.x - radius - 1, center.y - radius - 1, radius * 2 + 2, radius * 2 + 2 };
+}
+
+static void brain_hits_player(void* context, int brain, int player) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    if (!c->playing || g->worldMode != 1 || g->brain.brainHealth <= 0) return;
+    if (!CheckCollisionCircleRec(brain_center(g), g->brain.position.width / 2, g->player.rect)) return;
+
+    g->player.health--;   // player takes damage
+    if (g->player.health == 0) {
+        g->player.isAlive = false;
+        hit_animation(&g->player_anim);
+        death_animation(&g->player_anim);
+    }
+    else {
+        g->player.rect.x -= 40; // knockback
+    }
+}
+
+static void attack_hits_brain(void* context, int brain, int attack) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    if (!c->playing || g->worldMode != 1 || g->brain.brainHealth <= 0) return;
+    if (!g->player.isDealingDamage || !g->brain.isAlive) return;
+
+    if (CheckCollisionCircleRec(brain_center(g), g->brain.position.width / 2, attack_box(g))) {
+        if (g->brain.brainHealth > 0) g->brain.brainHealth--; // decrease brain health
+    }
+    if (g->brain.brainHealth == 0) {
+        g->brain.isAlive = false;
+    }
+}
+
+static void laser_hits_brain(void* context, int brain, int laser) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    // every step the beam overlaps it
+    if (!g->laserActive || !g->brain.isAlive || !g->player.isAlive || !g->started) return;
+    if (CheckCollisionCircleRec(brain_center(g), g->brain.position.width / 2, g->laserRect) && g->brain.brainHealth > 0) {
+        g->brain.brainHealth--;
+    }
+}
+
+static void mob_hits_player(void* context, int id, int player) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    MobStore* mobs = &g->mobs;
+    int mob = mobs->slot[id];
+    if (!c->playing || mob < 0 || !CheckCollisionRecs(g->player.rect, mobs->collider[mob])) return;
+
+    if (!mobs->isActive[mob]) {
+        mobs->isActive[mob] = true;
+        mobs->timer[mob] = EYEBALL_MOB_TIMER; //bug fix: activate mob on first collision
+    }
+    mobs->timer[mob] -= SIM_DT;
+
+    if (mobs->timer[mob] <= 0) {
+        mob_attack_animation1(&mobs->anim[mob]);
+
+        g->player.health--; // Player takes damage
+        hit_animation(&g->player_anim);
+        if (g->player.health == 0) {
+            hit_animation(&g->player_anim);
+            g->player.rect.x -= 10; // knockback
+            death_animation(&g->player_anim);
+            g->player.isAlive = false;
+        } else {
+            g->player.rect.x -= 10; // knockback
+        }
+        mobs->timer[mob] = EYEBALL_MOB_TIMER;
+    }
+}
+
+static void despawn_mob(Game* g, MobHandle handle) {
+    if (GetMobSlot(&g->mobs, handle) < 0) return;
+    ParkProxy(&g->contacts, g->mobProxy[handle.id]);
+    ParkProxy(&g->contacts, g->mobProxy[handle.id] + 1);
+    DespawnMob(&g->mobs, handle);
+}
+
+static void attack_hits_mob(void* context, int id, int attack) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    MobStore* mobs = &g->mobs;
+    int mob = mobs->slot[id];
+    if (!c->playing || mob < 0 || !g->player.isDealingDamage || !g->brain.isAlive) return;
+
+    if (CheckCollisionRecs(attack_box(g), mobs->hitbox[mob])) {
+        mobs->health[mob]--; // Damage mob
+        g->player.isDealingDamage = false; //prevents multiple damage frames
+        if (mobs->health[mob] <= 0) despawn_mob(g, GetMobById(mobs, id));
+    }
+}
+
+static void dot_hits_player(void* context, int index, int reach) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    Dot* dot = &g->dots[index];
+    Vector2 playerCenter = { g->player.rect.x + g->player.rect.width / 2, g->player.rect.y + g->player.rect.height / 2 };
+    if (!dot->active || !CheckCollisionCircles(dot->pos, DOT_RADIUS, playerCenter, PLAYER_DRAW_SIZE / 2)) return;
+
+    g->player.health -= 1;
+    dot->active = false;  // remove the dot
+    ParkProxy(&g->contacts, dot->proxy);
+
+    if (g->player.health <= 0) {
+        g->player.health = 0;
+        g->player.isAlive = false;
+        death_animation(&g->player_anim);
+    }
+}
+
+//================================== Triggers ==================================//
+
+static void collect_double_jump(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    PowUpDjump* pickup = &g->Djumps[volume->payload];
+    if (!c->playing || pickup->isCollected) return;
+    pickup->isCollected = true;
+    (g->player.doubleJumpCount)++;
+}
+
+static void collect_dash(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    PowUpDash* pickup = &g->Dashes[volume->payload];
+    if (!c->playing || pickup->isCollected) return;
+    pickup->isCollected = true;
+    (g->player.dashCount)++;
+}
+
+static void collect_levitation(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    PowUpLevitation* pickup = &g->Levitations[volume->payload];
+    if (!c->playing || pickup->isCollected) return;
+    pickup->isCollected = true;
+    g->player.gravitySign = -0.25f;
+    g->gravityTimer = LEVITATION_TIMER;
+}
+
+static void collect_noclip(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    PowUpNoclip* pickup = &g->Noclips[volume->payload];
+    if (!c->playing || pickup->isCollected) return;
+    pickup->isCollected = true;
+    g->player.phaseActive = true;
+    g->phaseTimer = NOCLIP_TIMER;
+}
+
+// hurts on every step inside
+static void damage_block_hits_player(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    if (!c->playing) return;
+
+    g->player.health--;
+    hit_animation(&g->player_anim);
+    if (g->player.health == 0) {
+        g->player.isAlive = false;
+        hit_animation(&g->player_anim);
+        death_animation(&g->player_anim);
+    }
+    else {
+        g->player.rect.x -= 20; // knockback
+    }
+}
+
+static void take_teleport_a(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    const LevelTeleport* teleport = &g->teleports[volume->payload];
+    if (!c->playing || !InputPressed(c->input, INPUT_INTERACT)) return;
+
+    g->player.rect.x = teleport->b.x;
+    g->player.rect.y = teleport->b.y - g->player.rect.height;
+    if (game_teleport_enters_arena(g, teleport)) {
+        g->cameraMode = 1; //static camera
+        g->worldMode = 1; //boss arena background
+    }
+}
+
+static void take_teleport_b(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    const LevelTeleport* teleport = &g->teleports[volume->payload];
+    if (!c->playing || !InputPressed(c->input, INPUT_INTERACT)) return;
+
+    g->player.rect.x = teleport->a.x;
+    g->player.rect.y = teleport->a.y - g->player.rect.height;
+}
+
+// the spawn point moves once, on the way in
+static void reach_checkpoint(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    g->spawnPoint.x = g->Checkpoint[volume->payload].x;
+    g->spawnPoint.y = g->Checkpoint[volume->payload].y;
+}
+
+static void talk_to_wizard(void* context, const TriggerVolume* volume, TriggerEvent event) {
+    ContactContext* c = context;
+    Game* g = c->g;
+    if (event == TRIGGER_EXIT) {
+        g->showDialogue = false; // Player left the range
+    }
+    else if (c->playing && InputPressed(c->input, INPUT_INTERACT)) {
+        g->showDialogue = true;
+        g->player.laserAcquired = true;
+    }
+}
+
+static const TriggerBehaviour triggerBehaviours[TRIGGER_TYPE_COUNT] = {
+    [TRIGGER_DOUBLE_JUMP] = { collect_double_jump, TRIGGER_ENTER },
+    [TRIGGER_DASH] = { collect_dash, TRIGGER_ENTER },
+    [TRIGGER_LEVITATION] = { collect_levitation, TRIGGER_ENTER },
+    [TRIGGER_NOCLIP] = { collect_noclip, TRIGGER_ENTER },
+    [TRIGGER_DAMAGE] = { damage_block_hits_player, TRIGGER_ENTER | TRIGGER_STAY },
+    [TRIGGER_TELEPORT_A] = { take_teleport_a, TRIGGER_ENTER | TRIGGER_STAY },
+    [TRIGGER_TELEPORT_B] = { take_teleport_b, TRIGGER_ENTER | TRIGGER_STAY },
+    [TRIGGER_CHECKPOINT] = { reach_checkpoint, TRIGGER_ENTER },
+    [TRIGGER_DIALOGUE] = { talk_to_wizard, TRIGGER_ENTER | TRIGGER_STAY | TRIGGER_EXIT },
+};
+
+static void touch_trigger(void* context, int volume, int player) {
+    ContactContext* c = context;
+    TouchTrigger(&c->g->triggers, volume, context);
+}
+
+// Fills the trigger table from the level, in the order the step used to poll them
+static void init_triggers(Game* g) {
+    TriggerTable* triggers = &g->triggers;
+    InitTriggerTable(triggers, triggerBehaviours, TRIGGER_TYPE_COUNT);
+    for (int i = 0; i < g->djumpCount; i++) AddTrigger(triggers, TRIGGER_DOUBLE_JUMP, i, g->Djumps[i].rect);
+    for (int i = 0; i < g->dashCount; i++) AddTrigger(triggers, TRIGGER_DASH, i, g->Dashes[i].rect);
+    for (int i = 0; i < g->levitationCount; i++) AddTrigger(triggers, TRIGGER_LEVITATION, i, g->Levitations[i].rect);
+    for (int i = 0; i < g->noclipCount; i++) AddTrigger(triggers, TRIGGER_NOCLIP, i, g->Noclips[i].rect);
+    for (int i = 0; i < g->damageBlockCount; i++) AddTrigger(triggers, TRIGGER_DAMAGE, i, g->damageBlock[i]);
+    for (int i = 0; i < g->teleportCount; i++) {
+        AddTrigger(triggers, TRIGGER_TELEPORT_A, i, g->teleports[i].a);
+        AddTrigger(triggers, TRIGGER_TELEPORT_B, i, g->teleports[i].b);
+    }
+    for (int i = 0; i < g->checkpointCount; i++) AddTrigger(triggers, TRIGGER_CHECKPOINT, i, g->Checkpoint[i]);
+    for (int i = 0; i < g->level->triggerCount; i++) {
+        const LevelTrigger* trigger = &g->level->triggers[i];
+        if (trigger->type != LEVEL_TRIGGER_DIALOGUE) continue;
+        // the wizard talks to anyone standing in his column, whatever the height
+        Rectangle column = { trigger->rect.x, -1.0e6f, trigger->rect.width, 2.0e6f };
+        AddTrigger(triggers, TRIGGER_DIALOGUE, (int)trigger->param, column);
+    }
+}
+
+// Handlers run in the order they are added here, which is the order the step used to
+// run its per-object loops in
+static void init_contacts(Game* g) {
+    Broadphase* contacts = &g->contacts;
+    InitBroadphase(contacts);
+    AddPairHandler(contacts, CONTACT_BRAIN, CONTACT_PLAYER, brain_hits_player);
+    AddPairHandler(contacts, CONTACT_BRAIN, CONTACT_ATTACK, attack_hits_brain);
+    // pickups, damage blocks, teleports, checkpoints and the wizard's dialogue: triggerBehaviours
+    AddPairHandler(contacts, CONTACT_TRIGGER, CONTACT_PLAYER, touch_trigger);
+    AddPairHandler(contacts, CONTACT_MOB, CONTACT_PLAYER, mob_hits_player);
+    AddPairHandler(contacts, CONTACT_MOB_HITBOX, CONTACT_ATTACK, attack_hits_mob);
+    AddPairHandler(contacts, CONTACT_DOT, CONTACT_PLAYER_REACH, dot_hits_player);
+    AddPairHandler(contacts, CONTACT_BRAIN, CONTACT_LASER, laser_hits_brain);
+
+    // trigger volumes, which never move; mobs get theirs as they spawn
+    init_triggers(g);
+    for (int i = 0; i < g->triggers.volumeCount; i++) AddProxy(contacts, CONTACT_TRIGGER, i, g->triggers.volumes[i].rect);
+
+    // the rest are placed before every pass
+    g->playerProxy = AddProxy(contacts, CONTACT_PLAYER, 0, (Rectangle){0});
+    g->reachProxy = AddProxy(contacts, CONTACT_PLAYER_REACH, 0, (Rectangle){0});
+    g->attackProxy = AddProxy(contacts, CONTACT_ATTACK, 0, (Rectangle){0});
+    g->laserProxy = AddProxy(contacts, CONTACT_LASER, 0, (Rectangle){0});
+    g->brainProxy = AddProxy(contacts, CONTACT_BRAIN, 0, (Rectangle){0});
+    g->dotProxyCount = 0;
+    g->mobProxyCount = 0;
+}
+
+static void place_contacts(Game* g) {
+    Broadphase* contacts = &g->contacts;
+    Vector2 playerCenter = { g->player.rect.x + g->player.rect.width / 2, g->player.rect.y + g->player.rect.height / 2 };
+    MoveProxy(contacts, g->playerProxy, g->player.rect);
+    MoveProxy(contacts, g->reachProxy, circle_bounds(playerCenter, PLAYER_DRAW_SIZE / 2));
+    MoveProxy(contacts, g->brainProxy, circle_bounds(brain_center(g), g->brain.position.width / 2));
+
+    if (g->player.isDealingDamage) MoveProxy(contacts, g->attackProxy, attack_box(g));
+    else ParkProxy(contacts, g->attackProxy);
+    if (g->laserActive) MoveProxy(contacts, g->laserProxy, g->laserRect);
+    else ParkProxy(contacts, g->laserProxy);
+
+    // a benchmark raising dotCount just gets more
+    while (g->dotProxyCount < g->dotCount) {
+        g->dots[g->dotProxyCount].proxy = AddProxy(contacts, CONTACT_DOT, g->dotProxyCount, (Rectangle){0});
+        g->dotProxyCount++;
+    }
+    for (int i = 0; i < g->dotProxyCount; i++) {
+        if (i < g->dotCount && g->dots[i].active) MoveProxy(contacts, g->dots[i].proxy, circle_bounds(g->dots[i].pos, DOT_RADIUS));
+        else ParkProxy(contacts, g->dots[i].proxy);
+    }
+}
+
+//==================================== Mobs ====================================//
+
+// Every mob the level places, at full health, each a frame further into the idle loop
+// than the last so they don't blink in step
+static void spawn_level_mobs(Game* g) {
+    ClearMobs(&g->mobs);
+    for (int i = 0; i < g->mobProxyCount; i++) {
+        ParkProxy(&g->contacts, g->mobProxy[i]);
+        ParkProxy(&g->contacts, g->mobProxy[i] + 1);
+    }
+
+    for (int i = 0; i < g->level->mobCount; i++) {
+        const LevelMob* source = &g->level->mobs[i];
+        // mob hitbox centered on collider
+        Rectangle hitbox = source->hitbox;
+        hitbox.x = source->collider.x + (source->collider.width - hitbox.width) / 2;
+        hitbox.y = source->collider.y + source->collider.height - hitbox.height;
+
+        Animation idle = { .speed = 0.1f };
+        mob_idle_animation(&idle);
+        idle.current_frame = i % (idle.last_frame + 1);
+
+        MobHandle handle = SpawnMob(&g->mobs, source->collider, hitbox, source->health, EYEBALL_MOB_TIMER, idle);
+        if (handle.generation == 0) break;  // store full
+
+        if (handle.id == g->mobProxyCount) {
+            g->mobProxy[handle.id] = AddProxy(&g->contacts, CONTACT_MOB, handle.id, source->collider);
+            AddProxy(&g->contacts, CONTACT_MOB_HITBOX, handle.id, hitbox);
+            g->mobProxyCount++;
+        }
+        else {
+            MoveProxy(&g->contacts, g->mobProxy[handle.id], source->collider);
+            MoveProxy(&g->contacts, g->mobProxy[handle.id] + 1, hitbox);
+        }
+    }
+}
+
+// One pass over the contiguous animation array; a finished bite falls back to idle
+static void update_mob_animations(MobStore* mobs, float dt) {
+    for (int i = 0; i < mobs->count; i++) {
+        Animation* anim = &mobs->anim[i];
+        if (anim->type == ONESHOT && anim->current_frame >= anim->last_frame && anim->duration_left <= dt) {
+            mob_idle_animation(anim);
+        }
+        else {
+            animation_update(anim, dt);
+        }
+    }
+}
+
+void game_init(Game* g, uint32_t seed, const Level* level) {
+    memset(g, 0, sizeof(*g));
+    g->rngState = seed ? seed : 0x9E3779B9u;   // xorshift state must be non-zero
+    g->level = level;
+
+    g->cameraMode = 0;
+    g->worldMode = 0;
+    g->spawnPoint = level->header->playerSpawn;
+    g->bossArenaSpawn = level->header->arenaSpawn;
+
+    g->player_anim = (Animation){
+        .first_frame = 0,
+        .last_frame = 7,
+        .current_frame = 0,
+        .speed = 0.15f,
+        .duration_left = 0.1f,
+        .row = 0,
+        .type = LOOP
+    };
+
+    g->boss_anim = (Animation){
+        .first_frame = 0,
+        .last_frame = 3,
+        .current_frame = 0,
+        .speed = 0.15f,
+        .duration_left = 0.1f,
+        .row = 0,
+        .type = ONESHOT
+    };
+
+    g->player = (Player){
+        //player collision box x, y, width, height
+        .rect = {g->spawnPoint.x, g->spawnPoint.y, PLAYER_DRAW_SIZE/4, PLAYER_DRAW_SIZE/2},
+        .velocityY = 0,
+        .facingDirection = 1,
+        .gravitySign = 1,
+        .phaseActive = false,
+        .isAlive = true,
+        .health = 10,
+        .isJumping = false,
+        .doubleJumpCount = 0,
+        .laserAcquired = false,
+        .dashCount = 0,
+        .isDashing = false,
+        .isAttacking = false,
+        .isDealingDamage = false
+    };
+
+    //LASER INITIALIZE
+    g->laserActive = false;
+    g->laserLength = 800;
+    g->laserDuration = 0.2f;
+    g->laserTimer = 0.0f;
+
+    InitMobStore(&g->mobs);
+
+    //BRAIN INITIALIZE
+    g->brain = (Brain){
+        .position = level->header->brainSpawn, // collision rectangle
+        .radius = 100,                         // circle radius
+        .brainHealth = 100,
+        .isAlive = true,
+        .speedX = 2.0f,
+        .dropping = false,
+        .floatY = level->header->brainSpawn.y,
+        .goingUp = false
+    };
+
+    g->dots = g->dotSlots;
+    g->dotCapacity = MAX_DOTS;
+    g->dotCount = MAX_DOTS;
+    for (int i = 0; i < MAX_DOTS; i++) {
+        g->dots[i].active = false;
+        g->dots[i].timer = 0;
+        g->dots[i].pos = (Vector2){0, 0};
+    }
+
+    // static layout is read straight out of the level image
+    g->platforms = level->platforms;
+    g->platformCount = level->platformCount;
+    g->damageBlock = level->damageBlocks;
+    g->damageBlockCount = level->damageBlockCount;
+    g->Checkpoint = level->checkpoints;
+    g->checkpointCount = level->checkpointCount;
+    g->teleports = level->teleports;
+    g->teleportCount = level->teleportCount;
+    load_pickups(g, level);
+
+    BuildCollisionGrid(&g->platformGrid, g->platforms, g->platformCount);
+    BuildTileOccupancy(&g->occupancy, level);
+    init_contacts(g);
+    spawn_level_mobs(g);
+
+    // camera offset is in virtual-target pixels, the window is letterboxed afterwards
+    g->camera.offset = (Vector2){VIRTUAL_WIDTH / 2.0f, VIRTUAL_HEIGHT / 2.0f};
+    g->camera.target = (Vector2){g->player.rect.x + g->player.rect.width / 2, g->player.rect.y + g->player.rect.height / 2};
+    g->camera.zoom = 1.0f;
+
+    g->direction = RIGHT;
+    g->light = GREEN_LIGHT;
+}
+
+// Moves the player by motion, stopping flush against the first platform in the way.
+// Returns true on a hit, with the face it stopped against in hit->normal.
+static bool move_player(Game* g, Vector2 motion, SweepHit* hit) {
+    Rectangle* rect = &g->player.rect;
+    if (!SweepCollisionGrid(&g->platformGrid, *rect, motion, hit)) {
+        rect->x += motion.x;
+        rect->y += motion.y;
+        return false;
+    }
+
+    // snap onto the face itself so the next step sees exact contact, not a sliver of gap or overlap
+    Rectangle plat = g->platforms[hit->index];
+    rect->x += motion.x * hit->time;
+    rect->y += motion.y * hit->time;
+    if (hit->normal.x < 0.0f) rect->x = plat.x - rect->width;
+    else if (hit->normal.x > 0.0f) rect->x = plat.x + plat.width;
+    else if (hit->normal.y < 0.0f) rect->y = plat.y - rect->height;
+    else rect->y = plat.y + plat.height;
+    return true;
+}
+
+void game_shutdown(Game* g) {
+    UnloadCollisionGrid(&g->platformGrid);
+    UnloadTileOccupancy(&g->occupancy);
+    UnloadBroadphase(&g->contacts);
+    UnloadTriggerTable(&g->triggers);
+}
+
+void game_use_dot_storage(Game* g, Dot* dots, int capacity) {
+    if (capacity < g->dotCount) return;
+
+    // dots already in play keep their state and their contact proxies
+    memcpy(dots, g->dots, sizeof(Dot) * g->dotCount);
+    memset(dots + g->dotCount, 0, sizeof(Dot) * (capacity - g->dotCount));
+    g->dots = dots;
+    g->dotCapacity = capacity;
+}
+
+bool game_teleport_enters_arena(const Game* g, const LevelTeleport* teleport) {
+    return teleport->b.x == g->bossArenaSpawn.x && teleport->b.y == g->bossArenaSpawn.y;
+}
+
+void game_start(Game* g, int level) {
+    g->started = true;
+    if (level == 2) {
+        g->player.rect.x = g->bossArenaSpawn.x;
+        g->player.rect.y = g->bossArenaSpawn.y;
+        g->cameraMode = 1; //static camera
+        g->worldMode = 1; //boss arena background
+    }
+}
+
+void game_step(Game* g, const InputFrame* input) {
+    int platformHits[MAX_PLATFORM_CANDIDATES];
+
+    // menu selection travels with the input so recordings replay it on the same step
+    if (input->startLevel && !g->started) {
+        game_start(g, input->startLevel);
+    }
+
+    bool playing = g->player.isAlive && g->started;
+    if (playing) {
+        PROFILE_BEGIN(PROFILE_BRAIN);
+        //BRAIN MOVEMENT, only in the boss arena
+        if (g->worldMode == 1 && g->brain.brainHealth > 0)
+        {
+            // HORIZONTAL movement always
+            g->brain.position.x += g->brain.speedX;
+
+            // reverse direction at horizontal bounds
+            if (g->brain.position.x <= 20000) g->brain.speedX = 2.0f;
+            if (g->brain.position.x + g->brain.position.width >= 21024) g->brain.speedX = -2.0f;
+
+            // occasionally start dropping (only when not already dropping)
+            if (!g->brain.dropping && !g->brain.goingUp && game_random(g, 0, 100) > 98) {
+                g->brain.dropping = true;
+            }
+
+            // VERTICAL movement
+            if (g->brain.dropping) {
+                g->brain.position.y += 4;  // drop speed
+                if (g->brain.position.y >= -20200) { // bottom Y
+                    g->brain.dropping = false;
+                    g->brain.goingUp = true;       // start floating back up
+                }
+            }
+            else if (g->brain.goingUp) {
+                g->brain.position.y -= 2;          // float up speed
+                if (g->brain.position.y <= -20620) { // float Y
+                    g->brain.position.y = -20620;
+                    g->brain.goingUp = false;
+                }
+            }
+        }
+        PROFILE_END(PROFILE_BRAIN);
+
+        // Light state logic (comment this if GREEN LIGHT AT ALL TIMES NEEDED)
+
+        //==========================================================================================
+        // if(worldMode == 0) //if in overworld use RED LIGHT/GREEN LIGHT CYCLE
+        // {
+        //     if (light == GREEN_LIGHT) {
+        //         if (elapsed >= 9.0 && !soundPlayed) {   // Play sound 1 second before red light
+        //             PlaySound(awake_fx);
+        //             soundPlayed = true;
+        //         }
+        //         if (elapsed >= 10.0) {
+        //             boss_awake_animation(&boss_anim);
+        //             light = RED_LIGHT;
+        //             state_start_time = GetTime();
+        //             soundPlayed = false;   // reset for next cycle
+        //         }
+        //     } else if (light == RED_LIGHT && elapsed >= 5.0) {
+        //         boss_sleep_animation(&boss_anim);
+        //         light = GREEN_LIGHT;
+        //         state_start_time = GetTime();
+        //         soundPlayed = false;   // reset for next cycle
+        //     }
+        // }
+
+
+
+
+        //==========================================================================================
+
+
+
+
+        //     if (light == GREEN_LIGHT) {
+        //     if (elapsed >= 9.0 && !soundPlayed) {
+        //         PlaySound(awake_fx);
+        //         soundPlayed = true;
+        //     }
+        //     if (elapsed >= 10.0) {
+        //         boss_awake_animation(&boss_anim);
+        //         light = RED_LIGHT;
+        //         state_start_time = GetTime();
+        //         soundPlayed = false;   // reset for next cycle
+        //     }
+        // } else if (light == RED_LIGHT) {
+        //     if (elapsed >= 5.0) {
+        //         boss_sleep_animation(&boss_anim);
+        //         light = GREEN_LIGHT;
+        //         state_start_time = GetTime();
+        //         soundPlayed = false;   // reset for next cycle
+        //     }
+        // }q
+
+
+
+        bool moving = false;  // Track if player is moving for animation
+
+
+        //=================================Power Up Section===================================//
+        PROFILE_BEGIN(PROFILE_POWERUPS);
+
+        if (g->gravityTimer > 0.0f) {
+            g->gravityTimer -= SIM_DT;
+
+            if (g->gravityTimer <= 0.0f) {
+                g->player.gravitySign = 1.0f;   // reset to normal gravity
+                g->gravityTimer = 0.0f;
+            }
+        }
+
+        if (g->phaseTimer > 0.0f) {
+            g->phaseTimer -= SIM_DT;
+
+            if (g->phaseTimer <= 0.0f) {
+                g->player.phaseActive = false;   // turn off noclip
+                g->phaseTimer = 0.0f;
+            }
+        }
+        PROFILE_END(PROFILE_POWERUPS);
+
+
+
+        //============================Collision part===========================================//
+        PROFILE_BEGIN(PROFILE_COLLISION);
+
+        // Detect collisions for jump
+        bool onLeftWall = false;    //touching left side of wall
+        bool onRightWall = false;   //touching right side of wall
+        bool onPlatform = false;    //standing on platform
+
+        float wallMargin = 2.0f;
+
+        // for (int i = 0; i < MAX_PLATFORMS; i++) {
+        //     Rectangle plat = platforms[i];  //check each platform one by one
+
+        //     if (CheckCollisionRecs(player.rect, plat)) {
+        //         // Detect right side wall contact
+        //         if (fabs((player.rect.x + player.rect.width) - plat.x) < wallMargin &&
+        //             player.rect.y + player.rect.height > plat.y &&
+        //             player.rect.y < plat.y + plat.height) {
+        //                 onRightWall = true;
+        //         }
+
+        //         // Detect left side wall contact
+        //         if (fabs(player.rect.x - (plat.x + plat.width)) < wallMargin &&
+        //              player.rect.y + player.rect.height > plat.y &&
+        //             player.rect.y < plat.y + plat.height) {
+        //                 onLeftWall = true;
+        //         }
+        //         // Calculate how much the player overlaps the platform
+        //         float overlapLeft = (player.rect.x + player.rect.width) - plat.x;
+        //         float overlapRight = (plat.x + plat.width) - player.rect.x;
+        //         float overlapTop = (player.rect.y + player.rect.height) - plat.y;
+        //         float overlapBottom = (plat.y + plat.height) - player.rect.y;
+
+        //         // Find smallest overlap to determine collision direction
+        //         float minOverlapX = (overlapLeft < overlapRight) ? overlapLeft : overlapRight;
+        //         float minOverlapY = (overlapTop < overlapBottom) ? overlapTop : overlapBottom;
+
+        //         if (minOverlapX < minOverlapY) {            // Horizontal collision
+        //             if (overlapLeft < overlapRight) {       //collision from left side
+        //                 player.rect.x -= overlapLeft;       //move player position to negate overlap
+        //             } else {                                //collision from right side
+        //                 player.rect.x += overlapRight;
+        //             }
+        //         } else {                                    // Vertical collision
+        //             if (overlapTop < overlapBottom) {       // Collided with top of platform
+        //                 player.rect.y -= overlapTop;
+        //                 player.velocityY = 0;
+        //                 player.isJumping = false;
+        //                 onPlatform = true;
+        //             } else {                                // Collided with bottom of platform
+        //                 player.rect.y += overlapBottom;
+        //                 player.velocityY = 0;
+        //             }
+        //         }
+        //     }
+        // }
+
+        // Contact probes read the tile bitmap: a wall or ground face within reach of the
+        // player's edges, rather than every nearby platform's edges
+        Rectangle body = g->player.rect;
+        onLeftWall = FindTileFace(&g->occupancy, TILE_FACE_LEFT, body.x + body.width, body.y, body.y + body.height, wallMargin);
+        onRightWall = FindTileFace(&g->occupancy, TILE_FACE_RIGHT, body.x, body.y, body.y + body.height, wallMargin);
+
+        // Standing: falls are swept and stop flush on the top face, so resting on a
+        // platform is contact rather than the overlap handled below
+        if (!g->player.phaseActive &&
+            FindTileFace(&g->occupancy, TILE_FACE_TOP, body.y + body.height, body.x, body.x + body.width, COLLISION_CONTACT_EPSILON)) {
+            g->player.isJumping = false;
+            onPlatform = true;
+        }
+
+        // broadphase: only platforms near the player (margin covers resolution pushes)
+        Rectangle nearPlayer = {
+            g->player.rect.x - g->player.rect.width - wallMargin,
+            g->player.rect.y - g->player.rect.height - wallMargin,
+            g->player.rect.width * 3 + wallMargin * 2,
+            g->player.rect.height * 3 + wallMargin * 2
+        };
+        int nearCount = QueryCollisionGrid(&g->platformGrid, nearPlayer, platformHits, MAX_PLATFORM_CANDIDATES);
+        if (nearCount > MAX_PLATFORM_CANDIDATES) {
+            TraceLog(LOG_WARNING, "GAME: %d platforms near the player, only the first %d are resolved", nearCount, MAX_PLATFORM_CANDIDATES);
+            nearCount = MAX_PLATFORM_CANDIDATES;
+        }
+
+        for (int n = 0; n < nearCount; n++) {
+
+            Rectangle plat = g->platforms[platformHits[n]];
+
+            // Collision Response
+            if (CheckCollisionRecs(g->player.rect, plat)) {        //check for collision
+                float overlapLeft = (g->player.rect.x + g->player.rect.width) - plat.x;   //overlap from left side
+                float overlapRight = (plat.x + plat.width) - g->player.rect.x;         //overlap from right side
+                float overlapTop = (g->player.rect.y + g->player.rect.height) - plat.y;   //overlap from top
+                float overlapBottom = (plat.y + plat.height) - g->player.rect.y;       //overlap from bottom
+
+                float minOverlapX = (overlapLeft < overlapRight) ? overlapLeft : overlapRight;  //checks which overlap less between left and right
+                float minOverlapY = (overlapTop < overlapBottom) ? overlapTop : overlapBottom;  //checks which overlap less between top and bottom
+
+                if (minOverlapX < minOverlapY) {            //if horizontal overlap less
+                    if(!g->player.phaseActive){
+                        if (overlapLeft < overlapRight) {       //if left overlap less, move to left of platform
+                            g->player.rect.x -= overlapLeft;
+                        }
+                        else {
+                            g->player.rect.x += overlapRight;
+                        }
+                    }
+                }
+                else{
+                    if(!g->player.phaseActive)
+                    {
+
+                        if (overlapTop < overlapBottom) {
+                            g->player.rect.y -= overlapTop;
+                            g->player.velocityY = 0;
+                            g->player.isJumping = false;
+                            onPlatform = true;
+                        }
+                        else {
+                            g->player.rect.y += overlapBottom;
+                            g->player.velocityY = 0;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (!onPlatform) g->player.isJumping = true;           // If not on a platform, player is jumping
+        PROFILE_END(PROFILE_COLLISION);
+
+
+        //======================================Movement Section/Controls=======================================//
+
+        if ((onLeftWall || onRightWall) && !onPlatform) {        //wallslide if player touching right/left wall
+            if((onLeftWall && (g->player.facingDirection == 1)) || (onRightWall && (g->player.facingDirection == -1))){
+                if(!g->player.phaseActive)
+                {
+                    g->player.isWallSliding = true;
+                    g->player.isJumping = true;
+                }
+            }
+        }
+
+        if (((g->player.isWallSliding && InputPressed(input, INPUT_WALL_DROP))|| onPlatform || !(onLeftWall || onRightWall))) {
+            g->player.isWallSliding = false;
+            // Add horizontal push-off from wall
+            SweepHit pushHit;
+            if (onRightWall) move_player(g, (Vector2){ 3.0f, 0.0f }, &pushHit);  // push right
+            if (onLeftWall) move_player(g, (Vector2){ -3.0f, 0.0f }, &pushHit); // push left
+        }
+
+
+        // Movement with A and D
+        if (InputDown(input, INPUT_LEFT)) {
+            g->player.facingDirection = -1;
+            if(!g->player.isWallSliding){          //disable horizontal movement during wallslide
+                g->player.rect.x -= PLAYER_SPEED;
+            }
+            g->direction = LEFT;
+            moving = true;
+        }
+        if (InputDown(input, INPUT_RIGHT)) {
+            g->player.facingDirection = 1;
+            if(!g->player.isWallSliding){          //disable horizontal movement during wallslide
+                g->player.rect.x += PLAYER_SPEED;
+            }
+            g->direction = RIGHT;
+            moving = true;
+        }
+
+
+
+        PROFILE_BEGIN(PROFILE_DASH);
+        // Dash with LShift
+        if (InputPressed(input, INPUT_DASH) && g->player.dashCount > 0 && !g->player.isDashing) {  //dash count = consumable dash, dont dash if one dash already happening
+            g->player.isDashing = true;            //toggle dashing status on
+
+            g->player.dashTargetX = g->player.rect.x + g->player.facingDirection * DASH_DISTANCE;    //position at end of dash
+            g->player.dashFrames = (int)(DASH_DISTANCE / DASH_STEP);    //how many frames dash last, increase dash step to make dash faster
+            g->player.dashCount--; //consume dash count
+        }
+        if (g->player.isDashing) {         //iteration for each dash frame
+            if ((g->player.facingDirection == 1 && g->player.rect.x >= g->player.dashTargetX) ||
+            (g->player.facingDirection == -1 && g->player.rect.x <= g->player.dashTargetX)) {
+                g->player.isDashing = false;   //target reached
+                g->player.dashFrames = 0;      //reset dash frames
+            }
+            else {
+                // the whole step is swept, so a platform thinner than DASH_STEP still stops the dash at its face
+                SweepHit hit;
+                if (move_player(g, (Vector2){ DASH_STEP * g->player.facingDirection, 0.0f }, &hit)) {
+                    g->player.isDashing = false;   //if collides, stop dash at the wall
+                    g->player.dashFrames = 0;
+                }
+                else {
+                    g->player.dashFrames--;        //reduce frame if no collision
+                    if (g->player.dashFrames <= 0) {
+                        g->player.isDashing = false;   //stop dash if dash frame runs out
+                    }
+                }
+            }
+        }
+        PROFILE_END(PROFILE_DASH);
+
+
+        //BOSS ARENA TELEPORT
+        // Debug teleport key
+        if (InputPressed(input, INPUT_TELEPORT_DEBUG)) {
+            g->player.rect.x = g->bossArenaSpawn.x;
+            g->player.rect.y = g->bossArenaSpawn.y;
+            g->cameraMode = 1; //static camera
+            g->worldMode = 1; //boss arena background
+
+        }
+        // Jump with W or SPACE
+        if (InputPressed(input, INPUT_JUMP) && g->light == GREEN_LIGHT) {
+            if (!g->player.isJumping && onPlatform) {          //Normal Jump
+                g->player.velocityY = JUMP_FORCE;
+                g->player.isJumping = true;
+            } else if (g->player.doubleJumpCount > 0 && g->player.isJumping) {    //double jump
+                g->player.velocityY = JUMP_FORCE;
+                (g->player.doubleJumpCount)--;
+            } else if (g->player.isWallSliding) {         // Wall jump
+                g->player.velocityY = JUMP_FORCE;
+                g->player.isJumping = true;
+                g->player.isWallSliding = false;
+
+                // Add horizontal push-off from wall
+                SweepHit pushHit;
+                if (onRightWall) move_player(g, (Vector2){ 20.0f, 0.0f }, &pushHit);  // push right
+                if (onLeftWall) move_player(g, (Vector2){ -20.0f, 0.0f }, &pushHit); // push left
+            }
+        }
+        if(!g->player.phaseActive){
+
+            if (!g->player.isWallSliding) {    //fast gravity downwards if not sliding (accelerated every frame)
+                g->player.velocityY += GRAVITY * g->player.gravitySign ;
+            }
+
+            else {
+                g->player.velocityY = 1.0f * g->player.gravitySign;  // slow slide down    (constant velocity, change if necessary)
+            }
+
+            // swept, so no fall speed can carry the player through a floor
+            SweepHit fallHit;
+            if (move_player(g, (Vector2){ 0.0f, g->player.velocityY }, &fallHit)) g->player.velocityY = 0;
+
+        }
+        if (InputPressed(input, INPUT_ATTACK_LIGHT) && !g->player.isAttacking) {
+            player_attack_animation1(&g->player_anim);
+            g->player.isAttacking = true;
+            g->player.isDealingDamage = true;
+        }
+        else if (InputPressed(input, INPUT_ATTACK_HEAVY) && !g->player.isAttacking) {
+            player_attack_animation2(&g->player_anim);
+            g->player.isAttacking = true;
+            g->player.isDealingDamage = true;
+        }
+
+        //===============================================================================================//
+
+        // idle animation if standing on platform and not moving/jumping
+        if (!g->player.isAttacking) {
+            if (onPlatform && !moving && !g->player.isJumping) {
+                if (g->player_anim.row != 0) {
+                    idle_animation(&g->player_anim);
+                }
+            } else {
+                select_player_animation(moving, g->player.isJumping, &g->player_anim);
+            }
+        }
+        animation_update(&g->player_anim, SIM_DT);
+
+        if (g->player.isAttacking && g->player_anim.current_frame >= g->player_anim.last_frame) {
+            g->player.isAttacking = false;
+            g->player.isDealingDamage = false;
+            idle_animation(&g->player_anim);
+        }
+
+        // Check fall out of screen
+        if (g->player.rect.y > FALL_DEATH_Y) {
+            g->player.isAlive = false;
+            death_animation(&g->player_anim);
+        }
+
+        // RED LIGHT: detect any move
+        if(g->worldMode==0){
+            if (g->light == RED_LIGHT && (
+            InputDown(input, INPUT_LEFT) || InputDown(input, INPUT_RIGHT) ||
+            InputDown(input, INPUT_JUMP) || InputDown(input, INPUT_DASH))){
+                if (g->player.isAlive) {
+                    g->player.isAlive = false;
+                    death_animation(&g->player_anim);
+
+                }
+            }
+        }
+    }
+
+
+    //================================== Eye Ball====================//
+    PROFILE_BEGIN(PROFILE_DOTS);
+
+    // // Spawn every 5 seconds
+    // dotTimer += GetFrameTime();
+    // if (dotTimer >= 10.0f && !dotActive) {
+    //     dotActive = true;
+    //     dotTimer = 0;
+
+    //     // Fixed spawn (always from left offscreen)
+    //     dotPos = (Vector2){player.rect.x-400,player.rect.y-400};
+
+
+    // }
+    for (int i = 0; i < g->dotCount; i++) {
+        g->dots[i].timer += SIM_DT;
+
+        if (g->dots[i].timer >= 6.0f && !g->dots[i].active) {
+            float squareHalfSize = 600; // distance from player to edge
+
+            // Randomly decide horizontal or vertical edge
+            bool horizontal = game_random(g, 0, 1); // 0=false (vertical), 1=true (horizontal)
+            float x, y;
+
+            if (horizontal) {
+                y = g->player.rect.y + (game_random(g, 0, 1) ? squareHalfSize : -squareHalfSize); // top or bottom
+                x = g->player.rect.x + game_random(g, -squareHalfSize, squareHalfSize);           // random along width
+            } else {
+                x = g->player.rect.x + (game_random(g, 0, 1) ? squareHalfSize : -squareHalfSize); // left or right
+                y = g->player.rect.y + game_random(g, -squareHalfSize, squareHalfSize);           // random along height
+            }
+
+            // Assign to dot
+            g->dots[i].pos = (Vector2){x, y};
+            g->dots[i].active = true;
+            g->dots[i].timer = 0;
+        }
+    }
+
+    // Convert to world coordinates with camera
+    Vector2 mouseWorld = GetScreenToWorld2D(input->mouseVirtual, g->camera);
+
+
+    for (int i = 0; i < g->dotCount; i++) {
+        if (g->dots[i].active) {
+
+            Vector2 playerCenter = {
+                g->player.rect.x + g->player.rect.width / 2,
+                g->player.rect.y + g->player.rect.height / 2
+            };
+
+            if (g->dots[i].pos.x < playerCenter.x) g->dots[i].pos.x += 3.5;
+            if (g->dots[i].pos.x > playerCenter.x) g->dots[i].pos.x -= 3.5;
+            if (g->dots[i].pos.y < playerCenter.y) g->dots[i].pos.y += 3.5;
+            if (g->dots[i].pos.y > playerCenter.y) g->dots[i].pos.y -= 3.5;
+
+
+            if (InputPressed(input, INPUT_ATTACK_LIGHT) &&
+            CheckCollisionPointCircle(mouseWorld, g->dots[i].pos, 20)) {
+                g->dots[i].active = false;  // destroy dot
+            }
+
+            Vector2 playerCenter1 = {
+                g->player.rect.x + g->player.rect.width / 2,
+                g->player.rect.y + g->player.rect.height / 2
+            };
+
+            float dx = g->dots[i].pos.x - playerCenter1.x;
+            float dy = g->dots[i].pos.y - playerCenter1.y;
+            float distance = sqrtf(dx*dx + dy*dy);
+
+            // If too far, deactivate dot so it can respawn
+            if (distance > 1200.0f) {
+                g->dots[i].active = false;
+                g->dots[i].timer = 0;  // optional: reset timer for respawn logic
+            }
+        }
+    }
+    PROFILE_END(PROFILE_DOTS);
+
+
+    //==================================== Animation Updates =======================================//
+
+    PROFILE_BEGIN(PROFILE_MOBS);
+    update_mob_animations(&g->mobs, SIM_DT);
+    PROFILE_END(PROFILE_MOBS);
+    animation_update(&g->player_anim, SIM_DT);
+    animation_update(&g->boss_anim, SIM_DT);
+
+
+
+
+    //==================================== LASER LOGIC =======================================//
+    PROFILE_BEGIN(PROFILE_LASER);
+
+
+    // Activate laser when pressing E
+    if (InputPressed(input, INPUT_LASER) && !g->laserActive && g->player.laserAcquired)
+    {
+        g->laserActive = true;
+        g->laserTimer = 0.0f;
+    }
+
+    // Update laser
+    if (g->laserActive)
+    {
+        g->laserTimer += SIM_DT;
+
+        // Follow player position
+        if (g->player.facingDirection == 1) // right
+        {
+            g->laserRect.x = g->player.rect.x + g->player.rect.width;
+            g->laserRect.width = g->laserLength;
+        }
+        else // left
+        {
+            g->laserRect.x = g->player.rect.x - g->laserLength;
+            g->laserRect.width = g->laserLength;
+        }
+        g->laserRect.y = g->player.rect.y+15;
+        if(g->player_anim.row == 4){ //if jumping, adjust laser height
+            g->laserRect.y = g->player.rect.y+10;
+        }
+        g->laserRect.height = g->player.rect.height;
+        g->laserRect.height = g->player.rect.height/20;
+
+        if (g->laserTimer >= g->laserDuration)
+        g->laserActive = false; // turn off after duration
+    }
+
+    PROFILE_END(PROFILE_LASER);
+
+
+    //==================================== CONTACTS =======================================//
+    // One broadphase pass pairs the player, attack box and laser with everything they
+    // can touch; the handlers above do the exact test and the response.
+    PROFILE_BEGIN(PROFILE_CONTACTS);
+    place_contacts(g);
+    ContactContext contact = { g, input, playing };
+    UpdateBroadphase(&g->contacts, &contact);
+    FinishTriggerStep(&g->triggers, &contact);
+    PROFILE_END(PROFILE_CONTACTS);
+
+
+    //====================================== RESET =======================================//
+    PROFILE_BEGIN(PROFILE_RESET);
+
+    if (InputPressed(input, INPUT_RESET)) {
+        // Reset world mode
+        g->worldMode = 0; //overworld
+
+
+        // Reset player
+        g->player.rect.x = g->spawnPoint.x;
+        g->player.rect.y = g->spawnPoint.y;
+        g->player.gravitySign = 1;
+        g->player.velocityY = 0;
+        g->player.facingDirection = 1;
+        g->player.isAlive = true;
+        g->player.health = 100;
+
+        g->player.isJumping = false;
+
+        g->player.doubleJumpCount = 0;
+        g->player.dashCount = 0;
+        g->player.isDashing = false;
+
+        // Reset mobs after player respawn, the dead ones come back
+        spawn_level_mobs(g);
+
+        // Reset animation to idle
+        idle_animation(&g->player_anim);
+
+        // Reset camera target
+
+
+        //reset double jumps
+        for (int i = 0; i < g->djumpCount; i++) {
+            g->Djumps[i].isCollected = false;
+        }
+        for (int i = 0; i < g->dashCount; i++) {
+            g->Dashes[i].isCollected = false;
+        }
+        for( int i=0 ; i<g->levitationCount; i++){
+            g->Levitations[i].isCollected = false;
+        }
+        for( int i=0 ; i<g->noclipCount; i++){
+            g->Noclips[i].isCollected = false;
+        }
+    }
+
+
+    if (InputPressed(input, INPUT_RESET)) {
+        // Reset world mode
+        //overworld
+
+
+        // Reset player
+        g->brain.brainHealth = 100;
+        g->brain.isAlive = true;
+        if(g->worldMode==0){
+            g->player.rect.x = g->spawnPoint.x;
+            g->player.rect.y = g->spawnPoint.y;
+            g->cameraMode = 0; //dynamic camera
+
+        }
+        if(g->worldMode==1){
+            g->player.rect.x = g->bossArenaSpawn.x;
+            g->player.rect.y = g->bossArenaSpawn.y;
+            g->cameraMode = 1; //static camera
+        }
+        g->player.gravitySign = 1;
+        g->player.velocityY = 0;
+        g->player.facingDirection = 1;
+        g->player.isAlive = true;
+        g->player.health = 100;
+
+        g->player.isJumping = false;
+
+        g->player.doubleJumpCount = 0;
+        g->player.dashCount = 0;
+        g->player.isDashing = false;
+
+        //reset mob
+
+
+        // Reset animation to idle
+        idle_animation(&g->player_anim);
+
+        // Reset camera target
+
+
+        //reset double jumps
+        for (int i = 0; i < g->djumpCount; i++) {
+            g->Djumps[i].isCollected = false;
+        }
+        for (int i = 0; i < g->dashCount; i++) {
+            g->Dashes[i].isCollected = false;
+        }
+        for( int i=0 ; i<g->levitationCount; i++){
+            g->Levitations[i].isCollected = false;
+        }
+        for( int i=0 ; i<g->noclipCount; i++){
+            g->Noclips[i].isCollected = false;
+        }
+    }
+
+    PROFILE_END(PROFILE_RESET);
+
+    PROFILE_BEGIN(PROFILE_CAMERA);
+    // Update camera to follow player
+    if(g->cameraMode == 0) { //dynamic camera
+        g->camera.target = (Vector2){g->player.rect.x + g->player.rect.width / 2, g->player.rect.y + g->player.rect.height / 2};
+    }
+    else if (g->cameraMode == 1) { //static camera for boss arena
+        g->camera.target = (Vector2){g->bossArenaSpawn.x, g->bossArenaSpawn.y};
+    }
+
+    PROFILE_END(PROFILE_CAMERA);
+
+    g->stepCount++;
+}
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "raylib.h"
+#include "animation.h"
+#include "mob_store.h"
+#include "broadphase.h"
+#include "trigger_table.h"
+#include "collision_grid.h"
+#include "tile_occupancy.h"
+#include "input.h"
+#include "level.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define PLAYER_DRAW_SIZE 100
+#define MOB_DRAW_SIZE 350
+
+#define MAX_DOTS 3         // eyeballs in play during normal games
+#define DOT_RADIUS 20
+#define NOCLIP 4    // noclip pickups a level can hold
+#define GRAVITY 0.5f
+#define JUMP_FORCE -10.0f
+#define PLAYER_SPEED 5.0f
+#define MAX_PLATFORM_CANDIDATES 32    // broadphase hits considered per query
+#define DOUBLE_JUMPS 16    // double jump pickups a level can hold
+#define DASHES 16    // dash pickups a level can hold
+#define TOTAL_TIME 120.0f // seconds (2min game timer)
+#define DASH_DISTANCE 300.0f
+#define DASH_STEP 60.0f
+#define EYEBALL_MOB_TIMER 1.0f // seconds
+#define LEVITATION 4    // levitation pickups a level can hold
+#define LEVITATION_TIMER 5.0f
+#define NOCLIP_TIMER 4.0f
+
+#define SIM_DT (1.0f / 60.0f)       // fixed simulation step, all per-step speeds are tuned for 60 Hz
+
+#define VIRTUAL_WIDTH 1080          // resolution the world is rendered at before letterboxing
+#define VIRTUAL_HEIGHT 720
+#define FALL_DEATH_Y (VIRTUAL_HEIGHT + 30)  // falling below this kills the player
+
+
+typedef enum Direction { LEFT = -1, RIGHT = 1 } Direction;
+typedef enum LightState { RED_LIGHT = 0, GREEN_LIGHT = 1 } LightState;
+
+// What a proxy in Game.contacts stands for. Circles get the box around them.
+typedef enum ContactType {
+    CONTACT_PLAYER = 0,     // player.rect
+    CONTACT_PLAYER_REACH,   // the circle dots hit, PLAYER_DRAW_SIZE across
+    CONTACT_ATTACK,         // melee attack box, parked unless dealing damage
+    CONTACT_LASER,          // parked unless the laser is on
+    CONTACT_BRAIN,
+    CONTACT_MOB,            // collider, index is the mob's handle id
+    CONTACT_MOB_HITBOX,
+    CONTACT_DOT,            // parked while inactive
+    CONTACT_TRIGGER,        // index is the volume in Game.triggers
+    CONTACT_TYPE_COUNT
+} ContactType;
+
+// Volumes in Game.triggers, payload is the index of what the volume stands for
+typedef enum TriggerType {
+    TRIGGER_DOUBLE_JUMP = 0,    // Djumps
+    TRIGGER_DASH,               // Dashes
+    TRIGGER_LEVITATION,         // Levitations
+    TRIGGER_NOCLIP,             // Noclips
+    TRIGGER_DAMAGE,             // damageBlock
+    TRIGGER_TELEPORT_A,         // teleports, either end
+    TRIGGER_TELEPORT_B,
+    TRIGGER_CHECKPOINT,         // Checkpoint
+    TRIGGER_DIALOGUE,           // level triggers
+    TRIGGER_TYPE_COUNT
+} TriggerType;
+
+typedef struct Player {
+    Rectangle rect;     //player hitbox
+    float velocityY;    //vertical velocity
+    int facingDirection;    //direction in which player is facing //-1 for left (subtracting abscissa), +1 for right
+    int gravitySign;
+
+    bool phaseActive;
+
+
+    bool isAlive;       //alive status
+
+    int health;         //health of player
+
+    bool isJumping;     //if player is on air
+    bool isDashing;     //if player is dashing
+    bool isWallSliding;
+    bool laserAcquired;
+    int doubleJumpCount;    //consumable double jumps
+
+    int dashCount;      //consumable dashes
+    float dashTargetX;  //
+    int dashFrames;
+    bool isAttacking;
+    bool isDealingDamage;
+} Player;
+
+typedef struct {
+    Vector2 pos;
+    bool active;
+    float timer;
+    int proxy;      // in Game.contacts, once the dot is below dotProxyCount
+} Dot;
+
+typedef struct PowUpDjump {
+    Rectangle rect;
+    bool isCollected;
+} PowUpDjump;
+
+typedef struct PowUpDash {
+    Rectangle rect;
+    bool isCollected;
+} PowUpDash;
+
+typedef struct PowUpNoclip {
+    Rectangle rect;
+    bool isCollected;
+} PowUpNoclip;
+
+typedef struct PowUpLevitation {
+    Rectangle rect;
+    bool isCollected;
+} PowUpLevitation;
+
+//BRAIN DEFINE
+typedef struct Brain {
+    Rectangle position;    // used for collisions
+    float radius;      // for drawing
+    int brainHealth;
+    bool isAlive;
+
+    float speedX;      // horizontal speed
+    bool dropping;
+    float floatY;      // resting Y for hover
+    bool goingUp;
+
+} Brain;
+
+// Everything the simulation reads and writes. No window, GL context or audio
+// device is needed to init or step a Game, so it can run headless.
+// The level must outlive the Game: layout arrays are used in place, not copied.
+typedef struct Game {
+    bool started;           // left the main menu
+    int cameraMode;         // 0 for dynamic, 1 for static
+    int worldMode;          // 0 for overworld, 1 for boss arena
+    Vector2 spawnPoint;
+    Vector2 bossArenaSpawn;
+    Camera2D camera;
+
+    Player player;
+    Animation player_anim;
+    Animation boss_anim;
+    Direction direction;
+    LightState light;
+
+    MobStore mobs;          // spawned from the level, a mob despawns when its health runs out
+    Brain brain;
+    Dot dotSlots[MAX_DOTS];
+    Dot* dots;              // dotSlots unless game_use_dot_storage hands in more
+    int dotCapacity;
+    int dotCount;           // dots simulated, MAX_DOTS unless a benchmark raises it, at most dotCapacity
+
+    bool laserActive;
+    Rectangle laserRect;    // laser hitbox
+    float laserLength;      // how long the laser reaches
+    float laserDuration;    // how long laser stays on screen in seconds
+    float laserTimer;
+
+    float gravityTimer;
+    float phaseTimer;
+
+    bool showDialogue;
+
+    // level layout, pointing into the loaded level image
+    const Level* level;
+    const Rectangle* platforms;
+    int platformCount;
+    CollisionGrid platformGrid;
+    TileOccupancy occupancy;    // solid tiles, for contact probes
+    const Rectangle* damageBlock;
+    int damageBlockCount;
+    const Rectangle* Checkpoint;
+    int checkpointCount;
+    const LevelTeleport* teleports;
+    int teleportCount;
+
+    PowUpDjump Djumps[DOUBLE_JUMPS];
+    int djumpCount;
+    PowUpDash Dashes[DASHES];
+    int dashCount;
+    PowUpNoclip Noclips[NOCLIP];
+    int noclipCount;
+    PowUpLevitation Levitations[LEVITATION];
+    int levitationCount;
+
+    // everything the player can touch, paired once per step (see game_step)
+    Broadphase contacts;
+    TriggerTable triggers;
+    int playerProxy;
+    int reachProxy;
+    int attackProxy;
+    int laserProxy;
+    int brainProxy;
+    int dotProxyCount;      // dots with a proxy, added as dotCount grows
+    int mobProxy[MAX_MOBS]; // collider proxy by mob id, the hitbox one follows it
+    int mobProxyCount;      // ids below this have their proxies, ids are handed out lowest first
+
+    uint32_t rngState;      // gameplay RNG, seeded by game_init so a replay reproduces every roll
+    long long stepCount;
+} Game;
+
+void game_init(Game* g, uint32_t seed, const Level* level);
+void game_shutdown(Game* g);
+
+// For stress runs: moves the dots to caller-owned storage that must outlive the game,
+// after which dotCount may be raised up to capacity. Ignored below dotCount.
+void game_use_dot_storage(Game* g, Dot* dots, int capacity);
+
+// Leaves the menu: level 1 starts at the overworld spawn, level 2 in the boss arena
+void game_start(Game* g, int level);
+
+// Advances the world by one fixed SIM_DT step
+void game_step(Game* g, const InputFrame* input);
+
+// True if the teleport's far end is the boss arena spawn, taking it switches to the arena
+bool game_teleport_enters_arena(const Game* g, const LevelTeleport* teleport);
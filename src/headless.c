@@ -0,0 +1,128 @@
+#include "headless.h"
+#include "game.h"
+#include "replay.h"
+#include "level.h"
+#include "profiler.h"
+#include <stdio.h>
+#include <time.h>
+
+static double WallSeconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Deterministic stand-in for a player: keeps running right, jumping, dashing and swinging
+static void ScriptedInput(const Game* g, InputFrame* input) {
+    long long step = g->stepCount;
+    input->down = 1u << INPUT_RIGHT;
+    input->pressed = 0;
+    input->mouseVirtual = (Vector2){VIRTUAL_WIDTH / 2.0f, VIRTUAL_HEIGHT / 2.0f};
+
+    if (step % 45 == 0) input->pressed |= 1u << INPUT_JUMP;
+    if (step % 120 == 60) input->pressed |= 1u << INPUT_DASH;
+    if (step % 30 == 15) input->pressed |= 1u << INPUT_ATTACK_LIGHT;
+    if (step % 90 == 0) input->pressed |= 1u << INPUT_INTERACT;
+    if (step % 240 == 200) input->pressed |= 1u << INPUT_LASER;
+    if (!g->player.isAlive) input->pressed |= 1u << INPUT_RESET;
+    input->down |= input->pressed;
+}
+
+// FNV-1a over the state a desync would show up in first
+static uint32_t HashBytes(uint32_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t GameChecksum(const Game* g) {
+    uint32_t hash = 2166136261u;
+    hash = HashBytes(hash, &g->player.rect, sizeof(g->player.rect));
+    hash = HashBytes(hash, &g->player.velocityY, sizeof(g->player.velocityY));
+    hash = HashBytes(hash, &g->player.health, sizeof(g->player.health));
+    hash = HashBytes(hash, &g->brain.position, sizeof(g->brain.position));
+    hash = HashBytes(hash, &g->brain.brainHealth, sizeof(g->brain.brainHealth));
+    for (int i = 0; i < MAX_DOTS; i++) hash = HashBytes(hash, &g->dots[i].pos, sizeof(g->dots[i].pos));
+    hash = HashBytes(hash, g->mobs.health, sizeof(g->mobs.health[0]) * g->mobs.count);
+    hash = HashBytes(hash, &g->rngState, sizeof(g->rngState));
+    return hash;
+}
+
+int RunHeadless(const LaunchOptions* options) {
+    static Game game;   // large, keep it off the stack
+    Replay playback = {0};
+    Replay recording = {0};
+
+    if (options->tracePath) BeginTraceCapture(options->tracePath);
+
+    uint32_t seed = options->hasSeed ? options->seed : 1;
+    if (options->replayPath) {
+        if (!BeginReplayPlayback(&playback, options->replayPath)) {
+            EndTraceCapture();
+            return 1;
+        }
+        seed = playback.header.seed;
+    }
+    if (options->recordPath && !BeginReplayRecording(&recording, options->recordPath, seed)) {
+        EndTraceCapture();
+        return 1;
+    }
+
+    Level level;
+    const char* levelPath = options->levelPath ? options->levelPath : LEVEL_DEFAULT_PATH;
+    double loadStart = WallSeconds();
+    if (!LoadLevel(&level, levelPath)) {
+        EndTraceCapture();
+        return 1;
+    }
+    double loadSeconds = WallSeconds() - loadStart;
+
+    game_init(&game, seed, &level);
+
+    InputFrame input = {0};
+    int deaths = 0;
+
+    double start = WallSeconds();
+    for (long long i = 0; options->replayPath || i < options->steps; i++) {
+        if (options->replayPath) {
+            if (!ReadReplayStep(&playback, &input)) break;
+        }
+        else {
+            if (options->input == HEADLESS_INPUT_SCRIPT) ScriptedInput(&game, &input);
+            if (i == 0) input.startLevel = options->level;
+        }
+        RecordReplayStep(&recording, &input);
+
+        bool wasAlive = game.player.isAlive;
+        PROFILE_BEGIN(PROFILE_SIM);
+        game_step(&game, &input);
+        PROFILE_END(PROFILE_SIM);
+        if (wasAlive && !game.player.isAlive) deaths++;
+        ConsumeInputPresses(&input);
+        PROFILE_FRAME_END();
+    }
+    double seconds = WallSeconds() - start;
+
+    EndReplay(&recording);
+    EndReplay(&playback);
+
+    if (options->replayPath) printf("headless: replay %s, seed %u\n", options->replayPath, seed);
+    else printf("headless: level %d, %s input, seed %u\n", options->level,
+        options->input == HEADLESS_INPUT_IDLE ? "idle" : "script", seed);
+    printf("headless: level layout loaded in %.3f ms\n", loadSeconds * 1e3);
+    printf("headless: %lld steps (%.1f s game time) in %.3f s real time\n",
+        game.stepCount, game.stepCount * SIM_DT, seconds);
+    printf("headless: %.0f steps/sec, %.3f us/step\n",
+        seconds > 0.0 ? game.stepCount / seconds : 0.0,
+        game.stepCount > 0 ? seconds * 1e6 / game.stepCount : 0.0);
+    printf("headless: player at (%.1f, %.1f), health %d, %d deaths, checksum %08x\n",
+        game.player.rect.x, game.player.rect.y, game.player.health, deaths, GameChecksum(&game));
+
+    game_shutdown(&game);
+    UnloadLevel(&level);
+    EndTraceCapture();
+    return 0;
+}
@@ -0,0 +1,7 @@
+#pragma once
+
+#include "options.h"
+
+// Steps the game as fast as possible with generated or replayed input and prints
+// steps/sec plus a checksum of the final state. Returns the process exit code.
+int RunHeadless(const LaunchOptions* options);
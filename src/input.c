@@ -0,0 +1,59 @@
+#include "input.h"
+
+static bool ActionDown(InputAction action) {
+    switch (action) {
+        case INPUT_LEFT:            return IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT);
+        case INPUT_RIGHT:           return IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT);
+        case INPUT_JUMP:            return IsKeyDown(KEY_W) || IsKeyDown(KEY_SPACE);
+        case INPUT_DASH:            return IsKeyDown(KEY_LEFT_SHIFT);
+        case INPUT_INTERACT:        return IsKeyDown(KEY_UP);
+        case INPUT_WALL_DROP:       return IsKeyDown(KEY_S);
+        case INPUT_LASER:           return IsKeyDown(KEY_E);
+        case INPUT_TELEPORT_DEBUG:  return IsKeyDown(KEY_T);
+        case INPUT_RESET:           return IsKeyDown(KEY_R);
+        case INPUT_ATTACK_LIGHT:    return IsMouseButtonDown(MOUSE_BUTTON_LEFT);
+        case INPUT_ATTACK_HEAVY:    return IsMouseButtonDown(MOUSE_BUTTON_RIGHT);
+        default:                    return false;
+    }
+}
+
+static bool ActionPressed(InputAction action) {
+    switch (action) {
+        case INPUT_LEFT:            return IsKeyPressed(KEY_A) || IsKeyPressed(KEY_LEFT);
+        case INPUT_RIGHT:           return IsKeyPressed(KEY_D) || IsKeyPressed(KEY_RIGHT);
+        case INPUT_JUMP:            return IsKeyPressed(KEY_W) || IsKeyPressed(KEY_SPACE);
+        case INPUT_DASH:            return IsKeyPressed(KEY_LEFT_SHIFT);
+        case INPUT_INTERACT:        return IsKeyPressed(KEY_UP);
+        case INPUT_WALL_DROP:       return IsKeyPressed(KEY_S);
+        case INPUT_LASER:           return IsKeyPressed(KEY_E);
+        case INPUT_TELEPORT_DEBUG:  return IsKeyPressed(KEY_T);
+        case INPUT_RESET:           return IsKeyPressed(KEY_R);
+        case INPUT_ATTACK_LIGHT:    return IsMouseButtonPressed(MOUSE_BUTTON_LEFT);
+        case INPUT_ATTACK_HEAVY:    return IsMouseButtonPressed(MOUSE_BUTTON_RIGHT);
+        default:                    return false;
+    }
+}
+
+void PollInput(InputFrame* input, int virtualWidth, int virtualHeight) {
+    input->down = 0;
+    for (int action = 0; action < INPUT_ACTION_COUNT; action++) {
+        if (ActionDown(action)) input->down |= 1u << action;
+        if (ActionPressed(action)) input->pressed |= 1u << action;
+    }
+
+    // same letterbox mapping as the final blit: fit to height, centered horizontally
+    Vector2 mouseScreen = GetMousePosition();
+    float scale = (float)GetScreenHeight() / virtualHeight;
+    int scaledWidth = (int)(virtualWidth * scale);
+    int offsetX = (GetScreenWidth() - scaledWidth) / 2;
+
+    input->mouseVirtual = (Vector2){
+        (mouseScreen.x - offsetX) / scale,
+        mouseScreen.y / scale
+    };
+}
+
+void ConsumeInputPresses(InputFrame* input) {
+    input->pressed = 0;
+    input->startLevel = 0;
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "raylib.h"
+
+// Gameplay actions the simulation reads, decoupled from physical keys/buttons
+typedef enum InputAction {
+    INPUT_LEFT = 0,         // A / LEFT
+    INPUT_RIGHT,            // D / RIGHT
+    INPUT_JUMP,             // W / SPACE
+    INPUT_DASH,             // LEFT SHIFT
+    INPUT_INTERACT,         // UP (teleporters, NPC)
+    INPUT_WALL_DROP,        // S (let go of a wall slide)
+    INPUT_LASER,            // E
+    INPUT_TELEPORT_DEBUG,   // T (jump straight to the boss arena)
+    INPUT_RESET,            // R
+    INPUT_ATTACK_LIGHT,     // left mouse button
+    INPUT_ATTACK_HEAVY,     // right mouse button
+    INPUT_ACTION_COUNT
+} InputAction;
+
+// Input as seen by one simulation step
+typedef struct InputFrame {
+    unsigned int down;      // bit per InputAction, held right now
+    unsigned int pressed;   // bit per InputAction, went down since the last simulation step
+    Vector2 mouseVirtual;   // mouse position in virtual-target (1080x720) coordinates
+    int startLevel;         // menu selection (1 or 2) to start on the next step, 0 for none
+} InputFrame;
+
+// Samples the keyboard/mouse once per rendered frame. Presses accumulate until
+// ConsumeInputPresses, so a press is seen by exactly one step no matter how many
+// (or how few) simulation steps run in a frame.
+void PollInput(InputFrame* input, int virtualWidth, int virtualHeight);
+void ConsumeInputPresses(InputFrame* input);
+
+inline static bool InputDown(const InputFrame* input, InputAction action)
+{
+    return (input->down >> action) & 1u;
+}
+
+inline static bool InputPressed(const InputFrame* input, InputAction action)
+{
+    return (input->pressed >> action) & 1u;
+}
@@ -0,0 +1,105 @@
+#include "jobs.h"
+#include "thread.h"
+#include <stddef.h>
+
+typedef struct Job {
+    JobFunc func;
+    void* data;
+} Job;
+
+typedef struct JobPool {
+    Thread* workers[MAX_JOB_WORKERS];
+    int workerCount;
+
+    ThreadMutex* mutex;
+    ThreadCond* pending;    // queue went non-empty, or the pool is stopping
+    ThreadCond* space;      // queue went non-full
+    bool stopping;
+
+    Job queue[JOB_QUEUE_CAPACITY];
+    int head;               // next job to run
+    int count;
+} JobPool;
+
+static JobPool pool;
+
+static void WorkerMain(void* unused) {
+    (void)unused;
+    for (;;) {
+        LockMutex(pool.mutex);
+        while (pool.count == 0 && !pool.stopping) WaitCond(pool.pending, pool.mutex);
+        if (pool.count == 0) {
+            UnlockMutex(pool.mutex);
+            break;
+        }
+
+        Job job = pool.queue[pool.head];
+        pool.head = (pool.head + 1) % JOB_QUEUE_CAPACITY;
+        pool.count--;
+        SignalCond(pool.space);
+        UnlockMutex(pool.mutex);
+
+        job.func(job.data);
+    }
+}
+
+void StartJobWorkers(int workerCount) {
+    if (pool.workerCount > 0) return;
+
+    if (workerCount <= 0) workerCount = GetProcessorCount() - 1;
+    if (workerCount > MAX_JOB_WORKERS) workerCount = MAX_JOB_WORKERS;
+    if (workerCount <= 0) return;
+
+    pool.mutex = NewMutex();
+    pool.pending = NewCond();
+    pool.space = NewCond();
+    if (!pool.mutex || !pool.pending || !pool.space) {
+        FreeCond(pool.space);
+        FreeCond(pool.pending);
+        FreeMutex(pool.mutex);
+        pool = (JobPool){0};
+        return;
+    }
+
+    pool.stopping = false;
+    pool.head = 0;
+    pool.count = 0;
+    for (int i = 0; i < workerCount; i++) {
+        Thread* worker = StartThread(WorkerMain, NULL);
+        if (!worker) break;
+        pool.workers[pool.workerCount++] = worker;
+    }
+}
+
+void StopJobWorkers(void) {
+    if (pool.workerCount == 0) return;
+
+    LockMutex(pool.mutex);
+    pool.stopping = true;
+    BroadcastCond(pool.pending);
+    UnlockMutex(pool.mutex);
+
+    for (int i = 0; i < pool.workerCount; i++) JoinThread(pool.workers[i]);
+    FreeCond(pool.space);
+    FreeCond(pool.pending);
+    FreeMutex(pool.mutex);
+    pool = (JobPool){0};
+}
+
+void PushJob(JobFunc func, void* data) {
+    if (pool.workerCount == 0) {
+        func(data);
+        return;
+    }
+
+    LockMutex(pool.mutex);
+    while (pool.count == JOB_QUEUE_CAPACITY) WaitCond(pool.space, pool.mutex);
+    pool.queue[(pool.head + pool.count) % JOB_QUEUE_CAPACITY] = (Job){ func, data };
+    pool.count++;
+    SignalCond(pool.pending);
+    UnlockMutex(pool.mutex);
+}
+
+int GetJobWorkerCount(void) {
+    return pool.workerCount;
+}
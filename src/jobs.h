@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stdbool.h>
+
+// Fixed pool of worker threads draining one FIFO of fire-and-forget jobs.
+// Jobs report back through their own data (see asset_loader.c), the pool only runs them.
+
+#define MAX_JOB_WORKERS 8
+#define JOB_QUEUE_CAPACITY 256
+
+typedef void (*JobFunc)(void* data);
+
+// workerCount <= 0 picks one worker per core, leaving one core for the main thread.
+// With no workers (single core, or threads unavailable) PushJob runs jobs inline.
+void StartJobWorkers(int workerCount);
+
+// Lets the queued jobs finish, then joins every worker
+void StopJobWorkers(void);
+
+// Blocks while the queue is full
+void PushJob(JobFunc func, void* data);
+
+int GetJobWorkerCount(void);
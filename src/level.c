@@ -0,0 +1,105 @@
+#include "level.h"
+#include "pak.h"
+#include "profiler.h"
+#include <string.h>
+
+_Static_assert(sizeof(LevelRect) == sizeof(Rectangle), "level rects are used as raylib Rectangles");
+
+static const void* SectionData(const unsigned char* base, const LevelHeader* header, LevelSectionId section, int* count) {
+    *count = (int)header->sections[section].count;
+    return base + header->sections[section].offset;
+}
+
+bool LoadLevelFromMemory(Level* level, const void* data, uint32_t size) {
+    const unsigned char* base = data;
+    const LevelHeader* header = data;
+
+    memset(level, 0, sizeof(*level));
+
+    if (size < sizeof(LevelHeader) || header->magic != LEVEL_MAGIC) {
+        TraceLog(LOG_WARNING, "LEVEL: not a level file");
+        return false;
+    }
+    if (header->version != LEVEL_VERSION || header->sectionCount != LEVEL_SECTION_COUNT) {
+        TraceLog(LOG_WARNING, "LEVEL: version %u is not supported (expected %d)", header->version, LEVEL_VERSION);
+        return false;
+    }
+    if (header->fileSize > size) {
+        TraceLog(LOG_WARNING, "LEVEL: file is truncated (%u of %u bytes)", size, header->fileSize);
+        return false;
+    }
+
+    for (int s = 0; s < LEVEL_SECTION_COUNT; s++) {
+        uint64_t offset = header->sections[s].offset;
+        uint64_t end = offset + (uint64_t)header->sections[s].count * LevelRecordSize(s);
+        if (offset % LEVEL_ALIGN != 0 || offset < sizeof(LevelHeader) || end > header->fileSize) {
+            TraceLog(LOG_WARNING, "LEVEL: section %d is out of bounds", s);
+            return false;
+        }
+    }
+
+    level->header = header;
+    level->layers = SectionData(base, header, LEVEL_SECTION_LAYERS, &level->layerCount);
+    level->tiles = SectionData(base, header, LEVEL_SECTION_TILES, &level->tileCount);
+    level->platforms = SectionData(base, header, LEVEL_SECTION_PLATFORMS, &level->platformCount);
+    level->damageBlocks = SectionData(base, header, LEVEL_SECTION_DAMAGE, &level->damageBlockCount);
+    level->checkpoints = SectionData(base, header, LEVEL_SECTION_CHECKPOINTS, &level->checkpointCount);
+    level->mobs = SectionData(base, header, LEVEL_SECTION_MOBS, &level->mobCount);
+    level->pickups = SectionData(base, header, LEVEL_SECTION_PICKUPS, &level->pickupCount);
+    level->triggers = SectionData(base, header, LEVEL_SECTION_TRIGGERS, &level->triggerCount);
+    level->teleports = SectionData(base, header, LEVEL_SECTION_TELEPORTS, &level->teleportCount);
+
+    // layers index into the tile section, one check per layer keeps draws in bounds
+    for (int i = 0; i < level->layerCount; i++) {
+        const LevelTileLayer* layer = &level->layers[i];
+        uint64_t end = (uint64_t)layer->firstTile + (uint64_t)layer->rows * (uint64_t)layer->cols;
+        if (layer->rows < 0 || layer->cols < 0 || layer->tileset >= LEVEL_TILESET_COUNT || end > (uint64_t)level->tileCount) {
+            TraceLog(LOG_WARNING, "LEVEL: tile layer %d is out of bounds", i);
+            memset(level, 0, sizeof(*level));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool LoadLevel(Level* level, const char* path) {
+    // the mounted archive already holds the level in memory, no mapping of our own needed
+    uint32_t packedSize = 0;
+    const void* packed = FindPakFile(path, &packedSize);
+    if (packed) {
+        if (!LoadLevelFromMemory(level, packed, packedSize)) {
+            TraceLog(LOG_WARNING, "LEVEL: [%s] failed to load", path);
+            return false;
+        }
+        TraceLog(LOG_INFO, "LEVEL: [%s] read from archive, %d layers, %d tiles, %d platforms", path,
+            level->layerCount, level->tileCount, level->platformCount);
+        return true;
+    }
+
+    TRACE_BEGIN("LoadLevel");
+    FileMapping mapping;
+    bool mapped = MapFile(&mapping, path);
+    TRACE_END("LoadLevel");
+    if (!mapped) {
+        memset(level, 0, sizeof(*level));
+        TraceLog(LOG_WARNING, "LEVEL: [%s] could not be opened", path);
+        return false;
+    }
+
+    if (mapping.size > UINT32_MAX || !LoadLevelFromMemory(level, mapping.data, (uint32_t)mapping.size)) {
+        TraceLog(LOG_WARNING, "LEVEL: [%s] failed to load", path);
+        UnmapFile(&mapping);
+        return false;
+    }
+
+    level->mapping = mapping;
+    TraceLog(LOG_INFO, "LEVEL: [%s] mapped, %d layers, %d tiles, %d platforms", path,
+        level->layerCount, level->tileCount, level->platformCount);
+    return true;
+}
+
+void UnloadLevel(Level* level) {
+    UnmapFile(&level->mapping);
+    memset(level, 0, sizeof(*level));
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "raylib.h"
+#include "level_format.h"
+#include "filemap.h"
+#include <stdbool.h>
+
+#define LEVEL_DEFAULT_PATH "assets/levels/world.lvl"
+
+// A loaded level: typed pointers straight into the file image, nothing is copied.
+// The image is either a mapped .lvl file or a caller-owned buffer.
+typedef struct Level {
+    const LevelHeader* header;
+
+    const LevelTileLayer* layers;
+    int layerCount;
+    const uint8_t* tiles;
+    int tileCount;
+
+    const Rectangle* platforms;
+    int platformCount;
+    const Rectangle* damageBlocks;
+    int damageBlockCount;
+    const Rectangle* checkpoints;
+    int checkpointCount;
+
+    const LevelMob* mobs;
+    int mobCount;
+    const LevelPickup* pickups;
+    int pickupCount;
+    const LevelTrigger* triggers;
+    int triggerCount;
+    const LevelTeleport* teleports;
+    int teleportCount;
+
+    FileMapping mapping;    // set when LoadLevel mapped a loose file
+} Level;
+
+// Maps the file and validates section bounds, no per-record parsing. A level inside
+// the mounted archive is read in place and must be unloaded before UnmountPak.
+bool LoadLevel(Level* level, const char* path);
+
+// Same checks over an image already in memory. The buffer must outlive the level.
+bool LoadLevelFromMemory(Level* level, const void* data, uint32_t size);
+
+void UnloadLevel(Level* level);
@@ -0,0 +1,138 @@
+#pragma once
+
+// On-disk layout of a .lvl file. Shared by the game, which maps the file and uses
+// it in place, and by offline tools that write it, so it depends only on stdint.
+//
+// A file is a LevelHeader followed by sections. Every section is an array of
+// fixed-size little-endian records at an 8-byte aligned offset from the start of
+// the file. Nothing is compressed or variable length: loading is one mmap plus a
+// bounds check per section.
+
+#include <stdint.h>
+
+#define LEVEL_MAGIC 0x564C4352u     // "RCLV" little-endian
+#define LEVEL_VERSION 1
+#define LEVEL_ALIGN 8
+
+// Inside the game these are raylib's own types (identical layout), so level data
+// can be handed straight to CheckCollisionRecs and friends
+#if defined(RAYLIB_H)
+typedef Rectangle LevelRect;
+typedef Vector2 LevelVec2;
+#else
+typedef struct LevelRect { float x, y, width, height; } LevelRect;
+typedef struct LevelVec2 { float x, y; } LevelVec2;
+#endif
+
+typedef enum LevelSectionId {
+    LEVEL_SECTION_LAYERS = 0,   // LevelTileLayer
+    LEVEL_SECTION_TILES,        // uint8_t tile indices, referenced by the layers
+    LEVEL_SECTION_PLATFORMS,    // LevelRect, solid collision
+    LEVEL_SECTION_DAMAGE,       // LevelRect, hurts on contact
+    LEVEL_SECTION_CHECKPOINTS,  // LevelRect, moves the respawn point
+    LEVEL_SECTION_MOBS,         // LevelMob
+    LEVEL_SECTION_PICKUPS,      // LevelPickup
+    LEVEL_SECTION_TRIGGERS,     // LevelTrigger
+    LEVEL_SECTION_TELEPORTS,    // LevelTeleport
+    LEVEL_SECTION_COUNT
+} LevelSectionId;
+
+#define LEVEL_TILE_SIZE 32         // world pixels per tile, layers are laid out on this grid
+#define LEVEL_TILE_EMPTY 0xFF       // layer cell with no tile, skipped when drawing
+
+// Tile indices into a tileset strip (tile i lives at x = i * tile size)
+typedef enum TILE_TYPE { TOP_TILE = 0, LEFT_TILE = 1, RIGHT_TILE = 2, BOTTOM_TILE = 3, CENTER_TILE = 4, LEFT_TOP_TILE = 5, RIGHT_TOP_TILE = 6, LEFT_BOTTOM_TILE = 7, RIGHT_BOTTOM_TILE = 8, TOP_LEFT_ANGLE = 9, RIGHT_BOTTOM_ANGLE = 10} TILE_TYPE;
+
+typedef enum LevelTileset {
+    LEVEL_TILESET_OVERWORLD = 0,
+    LEVEL_TILESET_ARENA,
+    LEVEL_TILESET_COUNT
+} LevelTileset;
+
+typedef enum LevelPickupType {
+    LEVEL_PICKUP_DOUBLE_JUMP = 0,
+    LEVEL_PICKUP_DASH,
+    LEVEL_PICKUP_NOCLIP,
+    LEVEL_PICKUP_LEVITATION,
+    LEVEL_PICKUP_COUNT
+} LevelPickupType;
+
+typedef enum LevelTriggerType {
+    LEVEL_TRIGGER_DIALOGUE = 0,     // wizard hands out the laser
+    LEVEL_TRIGGER_COUNT
+} LevelTriggerType;
+
+typedef struct LevelSection {
+    uint32_t offset;    // bytes from the start of the file
+    uint32_t count;     // records (bytes for LEVEL_SECTION_TILES)
+} LevelSection;
+
+typedef struct LevelHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t fileSize;
+    uint32_t sectionCount;          // LEVEL_SECTION_COUNT when written
+    LevelVec2 playerSpawn;          // overworld start
+    LevelVec2 arenaSpawn;           // boss arena start, also the arena camera target
+    LevelRect brainSpawn;
+    LevelSection sections[LEVEL_SECTION_COUNT];
+} LevelHeader;
+
+typedef struct LevelTileLayer {
+    uint32_t tileset;       // LevelTileset
+    int32_t rows;
+    int32_t cols;
+    int32_t startX;         // world position of the top-left tile
+    int32_t startY;
+    uint32_t firstTile;     // index into LEVEL_SECTION_TILES, rows * cols entries
+} LevelTileLayer;
+
+typedef struct LevelMob {
+    LevelRect collider;     // aggro area
+    LevelRect hitbox;
+    int32_t health;
+    uint32_t reserved;
+} LevelMob;
+
+typedef struct LevelPickup {
+    uint32_t type;          // LevelPickupType
+    LevelRect rect;
+} LevelPickup;
+
+typedef struct LevelTrigger {
+    uint32_t type;          // LevelTriggerType
+    uint32_t param;
+    LevelRect rect;
+} LevelTrigger;
+
+// Pressing interact inside either end moves the player to the other one
+typedef struct LevelTeleport {
+    LevelRect a;
+    LevelRect b;
+} LevelTeleport;
+
+// Size of one record in each section, used by both the writer and the loader's bounds checks
+inline static uint32_t LevelRecordSize(LevelSectionId section)
+{
+    switch (section) {
+        case LEVEL_SECTION_LAYERS:      return sizeof(LevelTileLayer);
+        case LEVEL_SECTION_TILES:       return sizeof(uint8_t);
+        case LEVEL_SECTION_PLATFORMS:   return sizeof(LevelRect);
+        case LEVEL_SECTION_DAMAGE:      return sizeof(LevelRect);
+        case LEVEL_SECTION_CHECKPOINTS: return sizeof(LevelRect);
+        case LEVEL_SECTION_MOBS:        return sizeof(LevelMob);
+        case LEVEL_SECTION_PICKUPS:     return sizeof(LevelPickup);
+        case LEVEL_SECTION_TRIGGERS:    return sizeof(LevelTrigger);
+        case LEVEL_SECTION_TELEPORTS:   return sizeof(LevelTeleport);
+        default:                        return 0;
+    }
+}
+
+_Static_assert(sizeof(LevelRect) == 16, "LevelRect must match raylib's Rectangle");
+_Static_assert(sizeof(LevelVec2) == 8, "LevelVec2 must match raylib's Vector2");
+_Static_assert(sizeof(LevelHeader) == 48 + 8 * LEVEL_SECTION_COUNT, "LevelHeader must have no padding");
+_Static_assert(sizeof(LevelTileLayer) == 24, "LevelTileLayer must have no padding");
+_Static_assert(sizeof(LevelMob) == 40, "LevelMob must have no padding");
+_Static_assert(sizeof(LevelPickup) == 20, "LevelPickup must have no padding");
+_Static_assert(sizeof(LevelTrigger) == 24, "LevelTrigger must have no padding");
+_Static_assert(sizeof(LevelTeleport) == 32, "LevelTeleport must have no padding");
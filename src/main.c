@@ -1,1205 +1,288 @@
 #include "raylib.h"
+#include "game.h"
+#include "headless.h"
+#include "replay.h"
+#include "level.h"
+#include "tilemap.h"
+#include "culling.h"
+#include "sprite_atlas.h"
+#include "sprite_sheet.h"
+#include "asset_loader.h"
+#include "audio.h"
+#include "resource_set.h"
+#include "resource_manager.h"
+#include "jobs.h"
+#include "pak.h"
+#include "pak_format.h"
+#include "resource_dir.h"
+#include "profiler.h"
+#include "input.h"
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <math.h>
-
-#define PLAYER_DRAW_SIZE 100
-#define MOB_DRAW_SIZE 350 
-
-#define MAX_DOTS 3
-#define DOT_RADIUS 20
-#define NOCLIP 1
-#define GRAVITY 0.5f
-#define JUMP_FORCE -10.0f
-#define PLAYER_SPEED 5.0f
-#define MAX_PLATFORMS 100
-#define DOUBLE_JUMPS 4
-#define DASHES 4
-#define TOTAL_TIME 120.0f // seconds (2min game timer)
-#define DASH_DISTANCE 300.0f
-#define DASH_STEP 60.0f
-#define EYEBALL_MOB_TIMER 1.0f // seconds
-#define CheckPointcount 10
-#define LEVITATION 1
-#define LEVITATION_TIMER 5.0f
-#define NOCLIP_TIMER 4.0f
-
-#define DamageBlocks 20
-
-#define MaxMobs 11
-
-
-typedef enum AnimationType { LOOP = 1, ONESHOT = 2 } AnimationType;
-typedef enum Direction { LEFT = -1, RIGHT = 1 } Direction;
-typedef enum LightState { RED_LIGHT = 0, GREEN_LIGHT = 1 } LightState;
-typedef enum TILE_TYPE { TOP_TILE = 0, LEFT_TILE = 1, RIGHT_TILE = 2, BOTTOM_TILE = 3, CENTER_TILE = 4, LEFT_TOP_TILE = 5, RIGHT_TOP_TILE = 6, LEFT_BOTTOM_TILE = 7, RIGHT_BOTTOM_TILE = 8, TOP_LEFT_ANGLE = 9, RIGHT_BOTTOM_ANGLE = 10} TILE_TYPE;
-
-typedef struct Animation {
-    int first_frame;
-    int last_frame;
-    int current_frame;
-    float speed;
-    float duration_left;
-    int row;
-    AnimationType type;
-} Animation;
-
-typedef struct Player {
-    Rectangle rect;     //player hitbox
-    float velocityY;    //vertical velocity
-    int facingDirection;    //direction in which player is facing //-1 for left (subtracting abscissa), +1 for right
-    int gravitySign;
-
-    bool phaseActive;     
-     
-
-    bool isAlive;       //alive status
-
-    int health;         //health of player
-
-    bool isJumping;     //if player is on air 
-    bool isDashing;     //if player is dashing
-    bool isWallSliding;      
-    bool laserAcquired;
-    int doubleJumpCount;    //consumable double jumps
-
-    int dashCount;      //consumable dashes
-    float dashTargetX;  //
-    int dashFrames;
-    bool isAttacking; 
-    bool isDealingDamage;
-} Player;
-
-typedef struct {
-    Vector2 pos;
-    bool active;
-    float timer;
-} Dot;
-
-typedef struct Mob {
-    Rectangle collider;
-    Rectangle hitbox; //mob hitbox
-    int mobHealth;
-    bool isAlive;
-    bool isActive; 
-    float timer;
-} Mob;
-
-typedef struct PowUpDjump {
-    Rectangle rect;
-    bool isCollected;
-} PowUpDjump;
-
-typedef struct PowUpDash {
-    Rectangle rect;
-    bool isCollected;
-} PowUpDash;
-
-typedef struct PowUpNoclip {
-    Rectangle rect;
-    bool isCollected;
-} PowUpNoclip;
-
-typedef struct PowUpLevitation {
-    Rectangle rect;
-    bool isCollected;
-} PowUpLevitation;
-
-//BRAIN DEFINE
-typedef struct Brain {
-    Rectangle position;    // used for collisions
-    float radius;      // for drawing
-    int brainHealth;
-    bool isAlive;
-
-    float speedX;      // horizontal speed
-    bool dropping;
-    float floatY;      // resting Y for hover
-    bool goingUp;
-    
-} Brain;
-
-
-void DrawTilemap(Texture2D tileset, int rows, int cols, int tilemap[rows][cols], int startX, int startY, int tileSize) {
-    for (int y = 0; y < rows; y++) {
-        for (int x = 0; x < cols; x++) {
-            int tileIndex = tilemap[y][x];
-
-            Rectangle src = {
-                tileIndex * tileSize,  	
-                0,
-                tileSize,
-                tileSize
-            };
-
-            Rectangle dest = {
-                startX + x * tileSize,
-                startY + y * tileSize,
-                tileSize,
-                tileSize
-            };
-
-            DrawTexturePro(tileset, src, dest, (Vector2){0, 0}, 0, WHITE);
-        }
-    }
+#include <time.h>
+
+#define MAX_FRAME_TIME 0.25f        // clamp on real frame time so a stall can't trigger a burst of catch-up steps
+#define SNAP_DISTANCE 500.0f        // moves larger than this in one step (teleports, respawns) are not interpolated
+#define ARENA_PREFETCH_DISTANCE 1500.0f // start decoding the arena once the player is this close to its teleporter
+
+typedef enum SceneId { SCENE_OVERWORLD = 0, SCENE_ARENA, SCENE_COUNT } SceneId;
+
+// Art only one scene draws: its resource set plus the level's tile layers that use its tileset
+typedef struct SceneAssets {
+    ResourceSet set;
+    LevelTileset tileset;
+    int tilesetSlot;        // tileset texture in set.textures
+    GpuTileMap gpuTiles;
+    TileChunkCache chunks;  // fallback when the tile shader is unavailable
+    bool useGpuTiles;
+    bool entered;
+} SceneAssets;
+
+
+// Blend between the last two simulation states for rendering, snapping across big jumps
+Vector2 interpolate_position(Vector2 previous, Vector2 current, float alpha) {
+    if (fabsf(current.x - previous.x) > SNAP_DISTANCE || fabsf(current.y - previous.y) > SNAP_DISTANCE)
+        return current;
+    return (Vector2){
+        previous.x + (current.x - previous.x) * alpha,
+        previous.y + (current.y - previous.y) * alpha
+    };
 }
 
-
-void boss_awake_animation(Animation* anim) {
-    anim->row = 1;
-    anim->first_frame = 0;
-    anim->last_frame = 3;
-    anim->current_frame = 0;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
+// Shown while the asset loader works, drawn straight to the window
+static void DrawLoadingScreen(float progress) {
+    const int barWidth = 400;
+    const int barHeight = 20;
+    int barX = GetScreenWidth() / 2 - barWidth / 2;
+    int barY = GetScreenHeight() / 2;
+
+    BeginDrawing();
+    ClearBackground(BLACK);
+    DrawText("LOADING", GetScreenWidth() / 2 - MeasureText("LOADING", 30) / 2, barY - 50, 30, RED);
+    DrawRectangle(barX, barY, (int)(barWidth * progress), barHeight, RED);
+    DrawRectangleLines(barX, barY, barWidth, barHeight, GRAY);
+    EndDrawing();
 }
 
-void boss_sleep_animation(Animation* anim) {
-    anim->row = 0;
-    anim->first_frame = 0;
-    anim->last_frame = 3;
-    anim->current_frame = 0;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
+Rectangle interpolate_rect(Rectangle previous, Rectangle current, float alpha) {
+    Vector2 pos = interpolate_position((Vector2){previous.x, previous.y}, (Vector2){current.x, current.y}, alpha);
+    return (Rectangle){pos.x, pos.y, current.width, current.height};
 }
 
-void animation_update(Animation* self) {
-    self->duration_left -= GetFrameTime();
-    if (self->duration_left <= 0.0f) {
-        self->duration_left = self->speed;
-        switch (self->type) {
-            case LOOP:
-                if (self->current_frame >= self->last_frame)
-                    self->current_frame = self->first_frame;
-                else
-                    self->current_frame += 1;
-                break;
-            case ONESHOT:
-                if (self->current_frame < self->last_frame)
-                    self->current_frame += 1;
-                break;
-        }
+// Tile layers come straight from the level, only the scene's tileset texture is resolved here.
+// One shaded quad per layer when the GL backend allows it, baked chunks otherwise.
+static void LoadSceneTiles(SceneAssets* scene, const Level* level) {
+    TileLayer* tileLayers = malloc(sizeof(TileLayer) * (level->layerCount > 0 ? level->layerCount : 1));
+    int tileLayerCount = 0;
+    for (int i = 0; i < level->layerCount; i++) {
+        const LevelTileLayer* layer = &level->layers[i];
+        if (layer->tileset != scene->tileset) continue;
+        tileLayers[tileLayerCount++] = (TileLayer){
+            scene->set.textures[scene->tilesetSlot],
+            layer->rows,
+            layer->cols,
+            level->tiles + layer->firstTile,
+            layer->startX,
+            layer->startY
+        };
     }
-}
 
-Rectangle animation_frame(Animation* self, int max_frames, int num_rows, Texture2D texture) {
-    float frame_width = (float)texture.width / max_frames;
-    float frame_height = (float)texture.height / num_rows;
-    float x = (self->current_frame % max_frames) * frame_width;
-    float y = self->row * frame_height;
-    return (Rectangle){x, y, frame_width, frame_height};
+    scene->useGpuTiles = LoadGpuTileMap(&scene->gpuTiles, tileLayers, tileLayerCount, LEVEL_TILE_SIZE);
+    if (!scene->useGpuTiles) BakeTileChunks(&scene->chunks, tileLayers, tileLayerCount, LEVEL_TILE_SIZE);
+    free(tileLayers);
 }
 
-void select_player_animation(bool moving, bool jumping, Animation* anim) {
-    int prev_row = anim->row;
-    AnimationType prev_type = anim->type;
-
-    if (jumping) {
-        anim->first_frame = 0;
-        anim->row = 4;
-        anim->last_frame = 3;
-        anim->type = LOOP;
-        
-    } else if (moving) {
-        anim->row = 1;
-        anim->first_frame = 0;
-        anim->last_frame = 7;
-        anim->type = LOOP;
-    } else {
-        anim->row = 0;
-        anim->first_frame = 0;
-        anim->last_frame = 7;
-        anim->type = LOOP;
+// Finishes the scene's resource set behind the loading screen (instant if it was
+// prefetched) and builds its tiles. False if the window was closed meanwhile.
+static bool EnterScene(SceneAssets* scene, const Level* level) {
+    while (!UpdateResourceSet(&scene->set, ASSET_UPLOAD_BUDGET)) {
+        if (WindowShouldClose()) return false;
+        DrawLoadingScreen(GetResourceSetProgress(&scene->set));
     }
+    LoadSceneTiles(scene, level);
+    scene->entered = true;
+    return true;
+}
 
-    // Reset current_frame if animation row or type changed
-    if (anim->row != prev_row || anim->type != prev_type) {
-        anim->current_frame = 0;
-        anim->duration_left = anim->speed;
+static void LeaveScene(SceneAssets* scene) {
+    if (scene->entered) {
+        if (scene->useGpuTiles) UnloadGpuTileMap(&scene->gpuTiles);
+        else UnloadTileChunks(&scene->chunks);
+        scene->entered = false;
     }
+    UnloadResourceSet(&scene->set);
 }
 
-
-//=============================== Animation Functions ===================================//
-
-void death_animation(Animation* anim) {
-    anim->row = 7;
-    anim->first_frame = 0;
-    anim->last_frame = 13;
-    anim->current_frame = 0;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
+static bool NearArenaTeleporter(const Game* g) {
+    for (int i = 0; i < g->teleportCount; i++) {
+        const LevelTeleport* teleport = &g->teleports[i];
+        if (!game_teleport_enters_arena(g, teleport)) continue;
+        float dx = (teleport->a.x + teleport->a.width / 2) - (g->player.rect.x + g->player.rect.width / 2);
+        float dy = (teleport->a.y + teleport->a.height / 2) - (g->player.rect.y + g->player.rect.height / 2);
+        if (dx * dx + dy * dy < ARENA_PREFETCH_DISTANCE * ARENA_PREFETCH_DISTANCE) return true;
+    }
+    return false;
 }
 
-void player_attack_animation1(Animation* anim) {
-    anim->row = 2;
-    anim->first_frame = 0;
-    anim->last_frame = 3;
-    anim->current_frame = 0;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
 
-}
-void player_attack_animation2(Animation* anim) {
-    anim->row = 3;
-    anim->first_frame = 0;
-    anim->last_frame = 2;
-    anim->current_frame = 0;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
-}
-void idle_animation(Animation* anim) {
-    
-    anim->row = 0;
-    anim->first_frame = 0;
-    anim->last_frame = 7;
-    anim->current_frame = 0;
-    anim->type = LOOP;
-    anim->duration_left = anim->speed;
-    
-}
 
-void hit_animation(Animation* anim) {
-    anim->row = 6;
-    anim->first_frame = 1;
-    anim->last_frame = 1;
-    anim->current_frame = 1;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
-}
-void mob_attack_animation1(Animation* anim) {
-    anim->row = 3;
-    anim->first_frame = 0;
-    anim->last_frame = 9;
-    anim->current_frame = 0;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
-}
-void mob_attack_animation2(Animation* anim) {
-    anim->row = 3;
-    anim->first_frame = 0;
-    anim->last_frame = 9;
-    anim->current_frame = 0;
-    anim->type = ONESHOT;
-    anim->duration_left = anim->speed;
-}
-void mob_idle_animation(Animation* anim) {
-    anim->row = 0;
-    anim->first_frame = 0;
-    anim->last_frame = 9;
-    anim->current_frame = 0;
-    anim->type = LOOP;
-    anim->duration_left = anim->speed;
-}
 
+int main(int argc, char** argv) {
+    LaunchOptions options;
+    ParseLaunchOptions(argc, argv, &options);
 
+    // assets come out of the packed archive when there is one, loose files otherwise
+    const char* pakPath = options.pakPath ? options.pakPath : SearchResourceFile(PAK_DEFAULT_NAME);
+    if (pakPath) MountPak(pakPath);
+
+    // --headless runs the simulation without opening a window or audio device
+    if (options.headless) {
+        int status = RunHeadless(&options);
+        UnmountPak();
+        return status;
+    }
 
+    // --trace records every profiled phase and asset load from here until exit
+    if (options.tracePath) BeginTraceCapture(options.tracePath);
 
-int main() {
     int screenWidth = 1080;
     int screenHeight = 720;
 
     const int virtualWidth = 1080;
     const int virtualHeight = 720;
 
-
-    int cameraMode = 0; // 0 for dynamic, 1 for static
-    int worldMode = 0; // 0 for overworld, 1 for boss arena
-    Vector2 spawnPoint = { 3180, 0}; 
-
     // Vector2 dotPos = {-100,-100};
     // bool dotActive = false;
     // float dotTimer = 0;
 
     SetConfigFlags(FLAG_WINDOW_RESIZABLE | FLAG_VSYNC_HINT);
 
+    // image and audio decoding runs on these from the first frame on
+    StartJobWorkers(0);
+
+    TRACE_BEGIN("InitAudioDevice");
     InitAudioDevice();                    
-    Sound awake_fx = LoadSound("assets/sound/awake_fx.mp3");  
+    TRACE_END("InitAudioDevice");
     bool soundPlayed = false; 
 
 
     
+    TRACE_BEGIN("InitWindow");
     InitWindow(screenWidth, screenHeight, "Merged Platformer + Animation");
+    TRACE_END("InitWindow");
     RenderTexture2D target = LoadRenderTexture(virtualWidth, virtualHeight);
-    const int TILE_SIZE = 32;  //each tile is 32x32 px
-
-    Texture2D tileset = LoadTexture("assets/map/tileset.png");
-    Texture2D phase_texture = LoadTexture("assets/powerups/phase.png");
-    Texture2D damage_block_texture = LoadTexture("assets/map/damage_block.png");
-    Texture2D teleporter_texture = LoadTexture("assets/map/teleporter.png");
-    Texture2D wizard_texture = LoadTexture("assets/npc/wizard.png");
-    Texture2D laser_texture = LoadTexture("assets/hero/laser.png");
-    Texture2D brain_texture = LoadTexture("assets/boss/brain.png");
-    Texture2D boss_arena_tileset = LoadTexture("assets/map/boss_arena_tileset.png");
-    Texture2D boss_arena_background = LoadTexture("assets/map/boss_arena.png");
-    Texture2D player_texture = LoadTexture("assets/hero/hero.png");
-    Texture2D mob_texture = LoadTexture("assets/enemies/eyehead.png");
-    Texture2D boss_background = LoadTexture("assets/boss/boss_static.png");
-    Texture2D boss_awake_texture = LoadTexture("assets/boss/boss_awake.png");
-    Texture2D boss_sleep_texture = LoadTexture("assets/boss/boss_sleep.png");
-    Texture2D double_jump_texture = LoadTexture("assets/powerups/djump.png");
-    Texture2D dash_texture = LoadTexture("assets/powerups/dash.png");
-    Texture2D eyeball = LoadTexture("assets/enemies/eyeball.png");
-    Texture2D levitation_texture = LoadTexture("assets/powerups/levitation.png");
-
-
-    if (player_texture.id == 0 || mob_texture.id == 0) {
-        CloseWindow();
-        return 1;
+    TrackRenderTexture("render target", target);
+    const int TILE_SIZE = LEVEL_TILE_SIZE;  //each tile is 32x32 px
+
+    // everything the teardown at the end of main touches, zeroed so every exit can go through it
+    int status = 0;
+    SpriteAtlas sprites = {0};
+    SpriteSheet player_sheet = {0}, mob_sheet = {0};
+    ResourceHandle player_handle = {0}, mob_handle = {0};
+    Level level = {0};
+    Replay playback = {0};
+    Replay recording = {0};
+    static Game game;
+
+    // backgrounds and tilesets belong to a scene: loaded on entry, released on exit
+    static SceneAssets scenes[SCENE_COUNT];
+    SceneAssets* overworld = &scenes[SCENE_OVERWORLD];
+    SceneAssets* arena = &scenes[SCENE_ARENA];
+    InitResourceSet(&overworld->set, "overworld");
+    overworld->tileset = LEVEL_TILESET_OVERWORLD;
+    overworld->tilesetSlot = AddSetTexture(&overworld->set, "assets/map/tileset.png");
+    const int bossBackgroundSlot = AddSetTexture(&overworld->set, "assets/boss/boss_static.png");
+    InitResourceSet(&arena->set, "boss arena");
+    arena->tileset = LEVEL_TILESET_ARENA;
+    arena->tilesetSlot = AddSetTexture(&arena->set, "assets/map/boss_arena_tileset.png");
+    const int arenaBackgroundSlot = AddSetTexture(&arena->set, "assets/map/boss_arena.png");
+
+    // the menu sits in the overworld, decode it alongside the global assets
+    PrefetchResourceSet(&overworld->set);
+
+    // every file is decoded on the job workers while a progress bar is up,
+    // this thread only uploads the finished images to the GPU
+    static AssetLoader loader;
+    InitAssetLoader(&loader);
+
+    // hero and mob sheets come back as images so their cells can be trimmed before upload
+    Image player_image = {0}, mob_image = {0};
+    QueueImageLoad(&loader, &player_image, "assets/hero/hero.png");
+    QueueImageLoad(&loader, &mob_image, "assets/enemies/eyehead.png");
+
+    // pickups, hazards, npc, projectiles and the brain share one atlas texture
+    Image spriteImages[SPRITE_COUNT] = {0};
+    for (int i = 0; i < SPRITE_COUNT; i++) QueueImageLoad(&loader, &spriteImages[i], GetSpritePath(i));
+
+    QueueSfxLoads(&loader);
+    StartAssetLoads(&loader);
+
+    while (!UpdateAssetLoader(&loader, ASSET_UPLOAD_BUDGET)) {
+        if (WindowShouldClose()) {
+            // images already handed over never reach the atlas or a sheet, the sounds go with the mixer
+            UnloadAssetLoader(&loader);
+            UnloadImage(player_image);
+            UnloadImage(mob_image);
+            for (int i = 0; i < SPRITE_COUNT; i++) UnloadImage(spriteImages[i]);
+            goto shutdown;
+        }
+        DrawLoadingScreen(GetAssetLoadProgress(&loader));
     }
+    LogAssetLoadTimes(&loader);
+    UnloadAssetLoader(&loader);
+
+    StartAudioMixer();
+    if (options.musicPath) PlayMusic(options.musicPath);
+
+    BuildSpriteAtlas(&sprites, spriteImages);
+
 
     const int max_frames = 14;
     const int num_rows = 8;
 
-    Animation player_anim = {
-        .first_frame = 0,
-        .last_frame = 7,
-        .current_frame = 0,
-        .speed = 0.15f,
-        .duration_left = 0.1f,
-        .row = 0,
-        .type = LOOP
-    };
-
-    Animation boss_anim = {
-        .first_frame = 0,
-        .last_frame = 3,
-        .current_frame = 0,
-        .speed = 0.15f,
-        .duration_left = 0.1f,
-        .row = 0,
-        .type = ONESHOT
-    };
 
     const int mob_max_frames = 10;
     const int mob_num_rows = 6;
 
-    const int boss_max_frames = 4;
-    const int boss_num_rows = 1;
-
-    Animation mob_anim = {
-        .first_frame = 0,
-        .last_frame = 9,
-        .current_frame = 0,
-        .speed = 0.1f,
-        .duration_left = 0.1f,
-        .row = 0,
-        .type = LOOP
-    };
-
-//======================================Player Initialization=================================//
-
-    Player player = {
-        //player collision box x, y, width, height
-        .rect = {spawnPoint.x,spawnPoint.y, PLAYER_DRAW_SIZE/4, PLAYER_DRAW_SIZE/2},
-        .velocityY = 0,
-        .facingDirection = 1,
-        .gravitySign = 1,
-        .phaseActive = false,
-        
-        .isAlive = true,
-
-        .health = 10,
-
-        .isJumping = false,
-
-        .doubleJumpCount = 0,
-        .laserAcquired = false,
-        .dashCount = 0,
-        .isDashing = false,
-        .isAttacking = false,
-        .isDealingDamage = false
-    };
-
-
-    //LASER INITIALIZE
-    bool laserActive = false;
-    Rectangle laserRect = {0};   // laser hitbox
-    float laserLength = 800;     // how long the laser reaches
-    float laserDuration = 0.2f;  // how long laser stays on screen in seconds
-    float laserTimer = 0.0f;
-
-    Mob mob [MaxMobs]= {
-        {.collider = {400, 50, 200, 50},
-        .hitbox = {400, 50, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-
-        {.collider = {1300, 210, 200, 50},
-        .hitbox = {1300, 210, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {2250, 250, 200, 50},
-        .hitbox = {2250, 250, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {3550, 100, 200, 50},
-        .hitbox = {3550, 100, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {4800, -150, 200, 50},
-        .hitbox = {4800, -150, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {5700, 40, 200, 50},
-        .hitbox = {5700, 40, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {6800, 260, 200, 50},
-        .hitbox = {6800, 260, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {8400, 100, 200, 50},
-        .hitbox = {8400, 100, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {9500, 150, 200, 50},
-        .hitbox = {9500, 150, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {11500, 200, 200, 50},
-        .hitbox = {11500, 200, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        },
-        {.collider = {13830, 50, 200, 50},
-        .hitbox = {13830, 50, 20, 50},
-        .mobHealth = 3,
-        .isAlive = true,
-        .isActive = false,
-        .timer = EYEBALL_MOB_TIMER
-        }
-    };
-
+    BuildSpriteSheet(&player_sheet, player_image, max_frames, num_rows);
+    BuildSpriteSheet(&mob_sheet, mob_image, mob_max_frames, mob_num_rows);
+    player_handle = AdoptTexture("assets/hero/hero.png", player_sheet.texture);
+    mob_handle = AdoptTexture("assets/enemies/eyehead.png", mob_sheet.texture);
 
-
-    //BRAIN INITIALIZE
-    Brain brain = {
-        .position = {20000+512, -20256, 200, 200}, // collision rectangle
-        .radius = 100,                         // circle radius
-        .brainHealth = 100,
-        .isAlive = true,
-        .speedX = 2.0f,
-        .dropping = false,
-        .floatY = -20256,
-        .goingUp = false
-    };
-
-    Dot dots[MAX_DOTS];
-
-    for (int i = 0; i < MAX_DOTS; i++) {
-    dots[i].active = false;
-    dots[i].timer = 0;
-    dots[i].pos = (Vector2){0, 0};
-}
-
-    
-
-
-
-
-
-   //======================================Level Layout PLATFORMS=========================================//
-
-    //add platforms with physics
-    // Rectangle platforms[MAX_PLATFORMS] = {
-    //     {100, 345, 160, 160},
-    //     {200, 280, 128, 192},
-    //     {400, 100, 192, 192}
-    // };
-    // int platform1[5][5] = {
-	// 	{LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE},
-	// 	{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-	// 	{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-	// 	{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-	// 	{LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-	// };
-
-	// int platform2[6][4] = {
-	// 	{LEFT_TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-	// 	{LEFT_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-	// 	{TOP_LEFT_ANGLE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    //     {CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    //     {CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    //     {CENTER_TILE, RIGHT_BOTTOM_ANGLE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-	// };
-
-    // int platform3[6][6] = {
-    //     {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    //     {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    //     {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    //     {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    //     {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    //     {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    // };
-    Rectangle teleportZoneA = { 6100, 60, 576, 256};  
-    Rectangle teleportZoneB = { 6200, 500, 160, 64 }; 
-
-    Rectangle teleportZoneC = {14400, 170, 288, 128};  
-    Rectangle teleportZoneD = { 20000+512, -20000-256}; 
-
-    Rectangle Checkpoint[CheckPointcount]= 
-{
-    {1750,100,32,32},
-    {3600,150,32,32},
-    {5300, 50,32,32},
-    {7230, 130,32,32},
-    {9830, 100,32,32},
-    {11730, 160,32,32},
-    {12950, 0,32,32}
-};
-
-    
-
-    Rectangle platforms[MAX_PLATFORMS] = {
-         {100, 345, 160, 160},//1
-        {200, 280, 128, 192},//2
-        {400, 100, 192, 192},//3
-        {700, 150, 256, 128},//4
-        {900, 250, 256, 128},//5
-        {1300, 260, 160, 160},//6
-        {1700, 100, 192, 160},//7
-        {2100, 200, 160, 160},//8
-        {2250, 300, 160, 160},//9
-        {2650, 250, 192, 128},//10
-        {2800, 200, 160, 128},//11
-        {3150, 50, 256, 128},//12
-        {3550, 150, 192, 128},//13
-        {4000, 180, 192, 160},//14
-        {4350, 100, 160, 128},//15
-        {4500, 140, 128, 96},//16
-        {4800, -100, 192, 96},//17
-        {4950, -200, 224, 128},//18
-        {5275, 50, 160, 160},//19
-        {5700, 90, 192, 128},//20
-        {6100, 60, 576, 256},//21 
-        {6800, 310, 320, 224},//22
-        {7200, 130, 256, 160},//23
-        {6200, 500, 160, 64},//24
-        {7500, 400, 192, 128},//25
-        {7800, 300, 160, 128},//26
-        {8100, 400, 160, 96},//27
-        {8400, 150, 256, 128},//28
-        {8570, 190, 160, 96},//29
-        {8900, 350, 256, 128},//30
-        {9070, 280, 256, 128},//31
-        {9500, 200, 192, 128},//32
-        {9800, 100, 160, 128},//33
-        {10100, 250, 256, 128},//34
-        {10300, 300, 160, 96},//35
-        {10700, 200, 192, 128},//36
-        {11100, 100, 224, 128},//37
-        {11500, 250, 256, 128},//38
-        {11700, 160, 192, 128},//39
-        {12000, 350, 96, 128},//40
-        {12000, 600, 320, 224},//41
-        {12550, 450, 96, 192},//42
-        {12450, 200, 96,192},//43
-        {12550, -50, 96, 192},//44
-        {12900, 0, 192, 96},//45
-        {13250, -100, 256, 128},//46
-        {13800, 100, 256, 160},//47
-        {14000, 210, 160, 128},//48
-        {14400, 170, 288, 128},//49
-
-
-       
-
-        //BOSS ARENA WALLS
-
-        {20000, -20000, 1024, 1024},            // bottom wall
-        //left wall
-        {20000-1024, -20000-1024, 1024,1024},            // left wall
-        //right wall
-        {20000+1024, -20000-1024, 1024,1024},          // right wall
-
-        {20000+928, -20000-200, 96, 96}, //right small platform 1
-
-        {20000+928-300, -20000-200-150, 128, 96}, //right small platform 2
-
-        {20000, -20000-200, 96, 96}, //left small platform 1
-
-        {20000+250, -20000-200-150, 128, 96}, //left small platform 2
-      
-        {3230, -210, 96, 256},
-
-
-    };
-
-    
-
-
-
-int platform1[5][5] = {
-		{LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-		{LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-	};
-
-	int platform2[6][4] = {
-		{LEFT_TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {CENTER_TILE, CENTER_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-	};
-
-    int platform3[6][6] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    };
-
-    int platform4[4][8] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE ,CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, CENTER_TILE}
-    };
-
-    int platform5[4][8] = {
-        {CENTER_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE ,CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    };
-
-    int platform6[5][5] = {
-		{LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-		{LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-		{LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-	};
-
-    int platform7[5][6] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-    int platform8[5][5] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-    int platform9[5][5] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-    
-    int platform10[5][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform11[4][5] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform12[4][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform13[5][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-
-
-int platform14[5][5] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform15[4][5] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform16[3][4] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform17[3][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform18[4][7] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform19[5][5] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform20[4][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform21[8][18] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform22[7][10] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-int platform23[5][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform24[2][5] ={
-    {LEFT_TOP_TILE, TOP_TILE ,TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE ,BOTTOM_TILE,BOTTOM_TILE,RIGHT_BOTTOM_TILE}
-};
-int platform25[4][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform26[3][4] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform27[3][5] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform28[4][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform29[3][5] = {
-    
-    {CENTER_TILE, CENTER_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform30[4][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform31[4][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {CENTER_TILE, CENTER_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform32[4][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform33[4][5] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform34[4][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform35[3][5] = {
-    {CENTER_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform36[4][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform37[4][7] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform38[4][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, CENTER_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform39[4][6] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {   CENTER_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-    //BOSS ARENA WALLS ARRAYS
-    int platform40[32][32] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    };
-
-    //left wall
-      int platform41[32][32] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        // Fill all rows with CENTER_TILE except first and last
-        // Each row must have 32 columns
-        // Left wall, 30 center, right wall
-        
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    };
-
-    //right wall
-      int platform42[32][32] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        // Fill all rows with CENTER_TILE except first and last
-        // Each row must have 32 columns
-        // Left wall, 30 center, right wall
-        
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    };
+    if (player_sheet.texture.id == 0 || mob_sheet.texture.id == 0) {
+        status = 1;
+        goto shutdown;
+    }
 
 
-        int platform43[3][3] = {
-        {LEFT_TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    };
-        int platform44[3][4] = {
-        {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-        {LEFT_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-        {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-    };
-    int platform60[4][3] = {
-    {LEFT_TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform61[7][10] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform62[6][3] = {
-    {LEFT_TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform63[6][3] = {
-
-    {LEFT_TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform64[6][3] = {
-
-    {LEFT_TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform65[3][6] = { 
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE },
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform66[4][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform67[5][8] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, CENTER_TILE}
-};
-int platform68[4][5] = {
-    {CENTER_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform69[4][9] = {
-    {LEFT_TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-int platform70[8][3] = {
-    {LEFT_TOP_TILE, TOP_TILE, RIGHT_TOP_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_TILE, CENTER_TILE, RIGHT_TILE},
-    {LEFT_BOTTOM_TILE, BOTTOM_TILE, RIGHT_BOTTOM_TILE}
-};
-
-
-
-    //temporary damage block
-    Rectangle damageBlock[DamageBlocks] = { 
-        {300, 200, 50, 50},
-        {1550,200,50,50},
-        {2500,250, 50, 50},
-        {3850,100,50,50},
-        {4700, 100,50,50},
-        {5550,100,50,50},
-        {8350,350,50,50},
-        {9370,170,50,50},
-        {10550,250,50,50},
-        {11000,150,50,50},
-        {12650,300,50,50},
-        {13620,-20,50,50}
-     }; 
-
-
-
-
-
-
-    //add power ups
-    PowUpDjump Djumps[DOUBLE_JUMPS] = {
-       { {1350, 160,20,20}, false },
-       { {4600, 40, 20,20}, false},
-       { {6280, 450, 20,20}, false},
-       { {7350, 70, 20, 20}, false}
-    };
+//======================================Game Initialization=================================//
 
-    PowUpDash Dashes[DASHES] = {
-        { {450, 50, 20, 20}, false},
-        { {5050, -300,20,20}, false},
-        { {6250, 450, 20,20}, false},
-        { {9000, 250, 20, 20}, false}
-    };
+    // level layout is compiled offline by levelc, mapped from disk and used in place
+    const char* levelPath = options.levelPath ? options.levelPath : LEVEL_DEFAULT_PATH;
+    if (!LoadLevel(&level, levelPath)) {
+        status = 1;
+        goto shutdown;
+    }
 
-    PowUpNoclip Noclips[NOCLIP] = {
-        {{200,160, 32,32 }, false}
-    };
+    // a replay brings its own seed, otherwise every session rolls differently unless --seed is given
+    uint32_t seed = options.hasSeed ? options.seed : (uint32_t)time(NULL);
+    bool replaying = options.replayPath && BeginReplayPlayback(&playback, options.replayPath);
+    if (replaying) seed = playback.header.seed;
+    if (options.recordPath) BeginReplayRecording(&recording, options.recordPath, seed);
 
-    PowUpLevitation Levitations[LEVITATION] = {
-       { {400, -70, 32, 32}, false }
-    };
+    // player, mobs, brain, pickups and the level collision layout live in the Game
+    game_init(&game, seed, &level);
 
-    
-
-    float gravityTimer = 0.0f;
-    float phaseTimer = 0.0f;
 
     Rectangle playButton = { 475, 350, 100, 50 };
     Rectangle playButton2 = {475, 450,100,50};
-    bool gamestarted = false;
 
     Rectangle quitbutton = {475, 550, 100, 50};
 
 
 
-    bool showDialogue = false;
     const char* dialogueText1 = "Hello, wanderer!  if you wish to slay the beast, \nyou must use this ability i am giving you\nI stole this spell from the temple of SHOGGOTH. \n\nPress the 'E' key to use the ability. \nGood luck! You need it! Ohohoho!";
     const char* dialogueText2 = "Go now, and may fortune favor you!";
     Rectangle dialogueRange = { 5800, 180, 128, 192 };  // Same as destRec from earlier
@@ -1207,28 +290,36 @@ int platform70[8][3] = {
 
 
 
-//====================================Camera Setting========================================//
+    // the game starts in the overworld, the arena is loaded when worldMode first switches to it
+    SceneId currentScene = SCENE_OVERWORLD;
+    if (!EnterScene(overworld, &level)) goto shutdown;
 
+//====================================Camera Setting========================================//
 
-    // Setting up camera
-    Camera2D camera = {0};
-    camera.offset = (Vector2){screenWidth / 2.0f, screenHeight / 2.0f};
-    camera.target = (Vector2){player.rect.x + player.rect.width / 2, player.rect.y + player.rect.height / 2};
-    camera.zoom = 1.0f;
 
-    Direction direction = RIGHT;
-    LightState light = GREEN_LIGHT;
     double state_start_time = GetTime();
-    Vector2 last_pos = {player.rect.x, player.rect.y};
+    Vector2 last_pos = {game.player.rect.x, game.player.rect.y};
 
-    //BOSS ARENA SPAWN POINT
-    Vector2 bossArenaSpawn = {20000+512, -20000-256};  // center of arena
-   
     int last_anim_row = -1;
 
+    // Fixed-step simulation state: input latched per frame, plus the previous step's
+    // positions so rendering can interpolate between the last two simulation states
+    InputFrame input = {0};
+    float accumulator = 0.0f;
+    Rectangle prevPlayerRect = game.player.rect;
+    Rectangle prevBrainRect = game.brain.position;
+    Vector2 prevDotPos[MAX_DOTS];
+    for (int i = 0; i < MAX_DOTS; i++) prevDotPos[i] = game.dots[i].pos;
+    Vector2 prevCameraTarget = game.camera.target;
+
+#if PROFILER_ENABLED
+    bool showProfiler = false;  // F3 toggles the per-phase timing overlay
+#endif
+
 //===================================main game loop=======================================//
 
     SetTargetFPS(60);
+    LightState lastLight = game.light;
 
     while (!WindowShouldClose()) {
         if (IsWindowResized() && !IsWindowFullscreen())
@@ -1259,993 +350,91 @@ int platform70[8][3] = {
  			ToggleFullscreen();
         }
 
-        float dt = GetFrameTime();
+        float frameTime = GetFrameTime();
         double elapsed = GetTime() - state_start_time;
 
+        PROFILE_BEGIN(PROFILE_INPUT);
+        PollInput(&input, virtualWidth, virtualHeight);
+        PROFILE_END(PROFILE_INPUT);
+
+#if PROFILER_ENABLED
+        if (IsKeyPressed(KEY_F3)) showProfiler = !showProfiler;
+#endif
+
         Vector2 mousePoint = GetMousePosition();
 
-        if(!gamestarted){
+        if(!game.started){
 
         if (CheckCollisionPointRec(mousePoint, playButton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
         {
-            gamestarted = !gamestarted; 
+            input.startLevel = 1;
         }
         if (CheckCollisionPointRec(mousePoint, playButton2) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
         {
-            gamestarted = !gamestarted;
-            player.rect.x = bossArenaSpawn.x;
-                player.rect.y = bossArenaSpawn.y;
-                cameraMode = 1; //static camera
-                worldMode = 1; //boss arena background
-                
+            input.startLevel = 2;
         }
         if (CheckCollisionPointRec(mousePoint, quitbutton) && IsMouseButtonPressed(MOUSE_LEFT_BUTTON))
         {
-            return 0;
+            break;
         }
     }
-        
-        if (player.isAlive && gamestarted) {
 
+        // Run as many fixed simulation steps as real time has accumulated
+        if (frameTime > MAX_FRAME_TIME) frameTime = MAX_FRAME_TIME;
+        accumulator += frameTime;
 
-            if(worldMode == 1) // if in boss arena
-            {
-                //BRAIN MOVEMENT
-                if (brain.brainHealth > 0)
-                {
-
-                    // horizontal movement
-                    if (brain.brainHealth > 0) 
-                    {
+        while (accumulator >= SIM_DT) {
+            accumulator -= SIM_DT;
 
-                       
-
-                        // HORIZONTAL movement always
-                        brain.position.x += brain.speedX;
-
-                        // reverse direction at horizontal bounds
-                        if (brain.position.x <= 20000) brain.speedX = 2.0f;
-                        if (brain.position.x + brain.position.width >= 21024) brain.speedX = -2.0f;
-
-                        // occasionally start dropping (only when not already dropping)
-                        if (!brain.dropping && !brain.goingUp && GetRandomValue(0, 100) > 98) {
-                            brain.dropping = true;
-                        }
-
-                        // VERTICAL movement
-                        if (brain.dropping) {
-                            brain.position.y += 4;  // drop speed
-                            if (brain.position.y >= -20200) { // bottom Y
-                                brain.dropping = false;
-                                brain.goingUp = true;       // start floating back up
-                            }
-                        }
-                        else if (brain.goingUp) {
-                            brain.position.y -= 2;          // float up speed
-                            if (brain.position.y <= -20620) { // float Y
-                                brain.position.y = -20620;
-                                brain.goingUp = false;
-                            }
-                        }
-                    
-                
-                    
-                    }
-
-                    // Check collision with player
-                    Vector2 brainCenter = {
-                        brain.position.x + brain.position.width / 2,
-                        brain.position.y + brain.position.height / 2
-                    };
-                    float brainRadius = brain.position.width / 2;
-
-                    if (CheckCollisionCircleRec(brainCenter, brainRadius, player.rect)) {
-                        player.health--;   // player takes damage
-                        
-                        if (player.health == 0) {
-                    
-                            player.isAlive = false;
-                            hit_animation(&player_anim);
-                            death_animation(&player_anim);
-                            
-                        } 
-                        else {
-                            player.rect.x -= 40; // knockback
-                        }
-                    }
-                     //check for player attack
-                    if (player.isDealingDamage && brain.isAlive) {
-                    //create an attack box larger than player hitbox
-                        Rectangle attackBox = player.rect;
-                        attackBox.width += 20.00f;
-
-
-                    // Check collision with brain
-                        if (CheckCollisionCircleRec(brainCenter, brainRadius, attackBox)) {
-                            if (brain.brainHealth > 0) brain.brainHealth--; // decrease brain health
-                        }
-                        if(brain.brainHealth == 0){
-                            brain.isAlive = false;
-                    
-                        }
-                    }
-
-
-                   
-
-                }
-            }
+            prevPlayerRect = game.player.rect;
+            prevBrainRect = game.brain.position;
+            for (int i = 0; i < MAX_DOTS; i++) prevDotPos[i] = game.dots[i].pos;
+            prevCameraTarget = game.camera.target;
 
-
-           
-
-                
-                // Light state logic (comment this if GREEN LIGHT AT ALL TIMES NEEDED)
-
-                //==========================================================================================
-            // if(worldMode == 0) //if in overworld use RED LIGHT/GREEN LIGHT CYCLE
-            // {  
-            //     if (light == GREEN_LIGHT) {
-            //         if (elapsed >= 9.0 && !soundPlayed) {   // Play sound 1 second before red light
-            //             PlaySound(awake_fx);
-            //             soundPlayed = true;
-            //         }
-            //         if (elapsed >= 10.0) {
-            //             boss_awake_animation(&boss_anim);
-            //             light = RED_LIGHT;
-            //             state_start_time = GetTime();
-            //             soundPlayed = false;   // reset for next cycle
-            //         }
-            //     } else if (light == RED_LIGHT && elapsed >= 5.0) {
-            //         boss_sleep_animation(&boss_anim);
-            //         light = GREEN_LIGHT;
-            //         state_start_time = GetTime();
-            //         soundPlayed = false;   // reset for next cycle
-            //     }
-            // }
-
-
-
-
-            //==========================================================================================
-
-
-            
-            
-        //     if (light == GREEN_LIGHT) {
-        //     if (elapsed >= 9.0 && !soundPlayed) {   
-        //         PlaySound(awake_fx);
-        //         soundPlayed = true;
-        //     }
-        //     if (elapsed >= 10.0) {
-        //         boss_awake_animation(&boss_anim);
-        //         light = RED_LIGHT;
-        //         state_start_time = GetTime();
-        //         soundPlayed = false;   // reset for next cycle
-        //     }
-        // } else if (light == RED_LIGHT) {
-        //     if (elapsed >= 5.0) {
-        //         boss_sleep_animation(&boss_anim);
-        //         light = GREEN_LIGHT;
-        //         state_start_time = GetTime();
-        //         soundPlayed = false;   // reset for next cycle
-        //     }
-        // }q
-        
-
-
-            bool moving = false;  // Track if player is moving for animation
-            
-
-            //=================================Power Up Section===================================//
-
-            //check if double jump powerup collected
-            for (int i = 0; i < DOUBLE_JUMPS; i++) {
-                if (CheckCollisionRecs(player.rect, Djumps[i].rect) && Djumps[i].isCollected == false) {
-                    Djumps[i].isCollected = true;
-                    (player.doubleJumpCount)++;
-                }
-            }
-
-            //check if dash powerup collected
-            for (int i = 0; i < DASHES; i++) {
-                if (CheckCollisionRecs(player.rect, Dashes[i].rect) && Dashes[i].isCollected == false) {
-                    Dashes[i].isCollected = true;
-                    (player.dashCount)++;
-                }
-            }
-
-            for (int i=0 ; i<LEVITATION; i++){
-                    if (CheckCollisionRecs(player.rect, Levitations[i].rect) && Levitations[i].isCollected == false) {
-                    Levitations[i].isCollected = true;
-                    player.gravitySign = -0.25f;
-                    gravityTimer = LEVITATION_TIMER;
-
-                }
+            // playback replaces the whole frame, live input takes over once the recording runs out
+            if (replaying && !ReadReplayStep(&playback, &input)) {
+                EndReplay(&playback);
+                replaying = false;
             }
+            RecordReplayStep(&recording, &input);
 
-            if (gravityTimer > 0.0f) {
-                gravityTimer -= GetFrameTime();
+            PROFILE_BEGIN(PROFILE_SIM);
+            game_step(&game, &input);
+            PROFILE_END(PROFILE_SIM);
 
-                if (gravityTimer <= 0.0f) {
-                player.gravitySign = 1.0f;   // reset to normal gravity
-                gravityTimer = 0.0f;
-                }
-                }
-
-            for (int i = 0; i < NOCLIP; i++) {
-        if (CheckCollisionRecs(player.rect, Noclips[i].rect) && !Noclips[i].isCollected) {
-            Noclips[i].isCollected = true;
-            player.phaseActive = true;       
-            phaseTimer = NOCLIP_TIMER;       
-        }
+            ConsumeInputPresses(&input);
         }
-        if (phaseTimer > 0.0f) {
-        phaseTimer -= GetFrameTime();
-
-        if (phaseTimer <= 0.0f) {
-        player.phaseActive = false;   // turn off noclip
-        phaseTimer = 0.0f;
-        }
-        }       
-
-
-
-            //============================Collision part===========================================//
-
-            // Detect collisions for jump
-            bool onLeftWall = false;    //touching left side of wall
-            bool onRightWall = false;   //touching right side of wall
-            bool onPlatform = false;    //standing on platform
-
-            float wallMargin = 2.0f;
-
-            // for (int i = 0; i < MAX_PLATFORMS; i++) {
-            //     Rectangle plat = platforms[i];  //check each platform one by one
-
-            //     if (CheckCollisionRecs(player.rect, plat)) {
-            //         // Detect right side wall contact
-            //         if (fabs((player.rect.x + player.rect.width) - plat.x) < wallMargin &&
-            //             player.rect.y + player.rect.height > plat.y &&
-            //             player.rect.y < plat.y + plat.height) {
-            //                 onRightWall = true;
-            //         }
-
-            //         // Detect left side wall contact
-            //         if (fabs(player.rect.x - (plat.x + plat.width)) < wallMargin &&
-            //              player.rect.y + player.rect.height > plat.y &&
-            //             player.rect.y < plat.y + plat.height) {
-            //                 onLeftWall = true;
-            //         }
-            //         // Calculate how much the player overlaps the platform
-            //         float overlapLeft = (player.rect.x + player.rect.width) - plat.x;
-            //         float overlapRight = (plat.x + plat.width) - player.rect.x;
-            //         float overlapTop = (player.rect.y + player.rect.height) - plat.y;
-            //         float overlapBottom = (plat.y + plat.height) - player.rect.y;
-
-            //         // Find smallest overlap to determine collision direction
-            //         float minOverlapX = (overlapLeft < overlapRight) ? overlapLeft : overlapRight;
-            //         float minOverlapY = (overlapTop < overlapBottom) ? overlapTop : overlapBottom;
-
-            //         if (minOverlapX < minOverlapY) {            // Horizontal collision
-            //             if (overlapLeft < overlapRight) {       //collision from left side
-            //                 player.rect.x -= overlapLeft;       //move player position to negate overlap
-            //             } else {                                //collision from right side
-            //                 player.rect.x += overlapRight;
-            //             }
-            //         } else {                                    // Vertical collision
-            //             if (overlapTop < overlapBottom) {       // Collided with top of platform
-            //                 player.rect.y -= overlapTop;
-            //                 player.velocityY = 0;
-            //                 player.isJumping = false;
-            //                 onPlatform = true;
-            //             } else {                                // Collided with bottom of platform
-            //                 player.rect.y += overlapBottom;
-            //                 player.velocityY = 0;
-            //             }
-            //         }
-            //     }
-            // }
-
-            for (int i = 0; i < MAX_PLATFORMS; i++) {
-               
-                Rectangle plat = platforms[i];
-
-                // Wall contact check (Touches platform wall, not overlap i.g - no collision)
-                // Left wall detection (player touching left side of platform)
-                if ((player.rect.x + player.rect.width >= plat.x - wallMargin) &&   //player width overlaps with left side of platform + margin
-                    (player.rect.x + player.rect.width <= plat.x + wallMargin) &&   //player width does not overlap too deep from left side of platform
-                                                                                    //range margin distance outside -> platform wall -> margine distance inside
-                    (player.rect.y + player.rect.height > plat.y) &&                //player body under top of platform
-                    (player.rect.y < plat.y + plat.height)){                        //player body under bottom of platform
-                        onLeftWall = true;
-                }
-
-                // Right wall detection (player touching right side of platform)
-                if ((player.rect.x <= plat.x + plat.width + wallMargin) &&
-                    (player.rect.x >= plat.x + plat.width - wallMargin) &&
-                    (player.rect.y + player.rect.height > plat.y) &&
-                    (player.rect.y < plat.y + plat.height)) {
-                        onRightWall = true;
-                }
-
-
-                // Collision Response 
-                if (CheckCollisionRecs(player.rect, plat)) {        //check for collision
-                    float overlapLeft = (player.rect.x + player.rect.width) - plat.x;   //overlap from left side
-                    float overlapRight = (plat.x + plat.width) - player.rect.x;         //overlap from right side   
-                    float overlapTop = (player.rect.y + player.rect.height) - plat.y;   //overlap from top
-                    float overlapBottom = (plat.y + plat.height) - player.rect.y;       //overlap from bottom
-
-                    float minOverlapX = (overlapLeft < overlapRight) ? overlapLeft : overlapRight;  //checks which overlap less between left and right
-                    float minOverlapY = (overlapTop < overlapBottom) ? overlapTop : overlapBottom;  //checks which overlap less between top and bottom
-
-                    if (minOverlapX < minOverlapY) {            //if horizontal overlap less
-                        if(!player.phaseActive){
-                        if (overlapLeft < overlapRight) {       //if left overlap less, move to left of platform 
-                            player.rect.x -= overlapLeft;
-                        }
-                        else {
-                            player.rect.x += overlapRight;
-                        }
-                    }
-                    }
-                    else{
-                        if(!player.phaseActive)
-                        {
-
-                            if (overlapTop < overlapBottom) {
-                                player.rect.y -= overlapTop;
-                                player.velocityY = 0;
-                                player.isJumping = false;
-                                onPlatform = true;
-                            }
-                            else {
-                                player.rect.y += overlapBottom;
-                                player.velocityY = 0;
-                            }
-                        }
-                    }
-                }
-            }
-
-            if (!onPlatform) player.isJumping = true;           // If not on a platform, player is jumping
-
-
-
-            //============================== Dialogue Section ================================//
-            if (player.rect.x > 5800 && player.rect.x < 6000) 
-                {
-                // Player is in NPC range
-                if (IsKeyPressed(KEY_UP)) {
-                    showDialogue = true;
-                    player.laserAcquired = true;
-                }
-            } 
-            else 
-            {
-                showDialogue = false; // Player left the range
-            }
-
-            
-
-
-            
-            
-
-            //======================================Movement Section/Controls=======================================//
-
-            if ((onLeftWall || onRightWall) && !onPlatform) {        //wallslide if player touching right/left wall
-                if((onLeftWall && (player.facingDirection == 1)) || (onRightWall && (player.facingDirection == -1))){
-                    if(!player.phaseActive)
-                    {
-                        player.isWallSliding = true;
-                        player.isJumping = true;
-                    }
-                }
-            }
-            
-            if (((player.isWallSliding && IsKeyPressed(KEY_S))|| onPlatform || !(onLeftWall || onRightWall))) {
-                player.isWallSliding = false;
-                 // Add horizontal push-off from wall
-                    if (onRightWall) player.rect.x += 3.0f;  // push right
-                    if (onLeftWall) player.rect.x -= 3.0f; // push left
-            }
 
+        // the boss wakes with a growl as the light turns red
+        if (game.light == RED_LIGHT && lastLight != RED_LIGHT) PlaySfx(SFX_AWAKE);
+        lastLight = game.light;
+        UpdateAudio();
 
-            // Movement with A and D
-                if (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)) {
-                    player.facingDirection = -1;
-                    if(!player.isWallSliding){          //disable horizontal movement during wallslide
-                        player.rect.x -= PLAYER_SPEED;
-                    }
-                    direction = LEFT;
-                    moving = true;
-                }
-                if (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) {
-                    player.facingDirection = 1;
-                    if(!player.isWallSliding){          //disable horizontal movement during wallslide
-                        player.rect.x += PLAYER_SPEED;
-                    }
-                    direction = RIGHT;
-                    moving = true;
-                }
-            
-
-            
-            // Dash with LShift
-            if (IsKeyPressed(KEY_LEFT_SHIFT) && player.dashCount > 0 && !player.isDashing) {  //dash count = consumable dash, dont dash if one dash already happening
-                player.isDashing = true;            //toggle dashing status on
-
-                player.dashTargetX = player.rect.x + player.facingDirection * DASH_DISTANCE;    //position at end of dash
-                player.dashFrames = (int)(DASH_DISTANCE / DASH_STEP);    //how many frames dash last, increase dash step to make dash faster
-                player.dashCount--; //consume dash count
-            }
-            if (player.isDashing) {         //iteration for each dash frame
-                float step = DASH_STEP * player.facingDirection;
-                
-                Rectangle next_rect = player.rect; //placeholder rectangle to check for collisions before changing player pos
-                next_rect.x = player.rect.x + step; //updating position of rectangle to next frame of dash
-
-                bool collision = false;
-                for (int i = 0; i < MAX_PLATFORMS; i++) {       //checking collision with platforms
-                    if (CheckCollisionRecs(next_rect, platforms[i])) {
-                        
-                        if (player.facingDirection == 1) {
-                            player.rect.x = platforms[i].x - player.rect.width;     //move player to wall side if there is collision
-                        }
-                        else {
-                            player.rect.x = platforms[i].x + platforms[i].width;
-                        }
-                        collision = true;
-                        break;
-                    }
-                }
-
-                if (collision ||
-                    (player.facingDirection == 1 && player.rect.x >= player.dashTargetX) ||
-                    (player.facingDirection == -1 && player.rect.x <= player.dashTargetX)) {
-                        player.isDashing = false;   //if collides, stop dash
-                        player.dashFrames = 0;      //reset dash frames
-                }
-                else {
-                    player.rect.x = next_rect.x;
-                    player.dashFrames--;        //change position and reduce frame if no collision
-                    if (player.dashFrames <= 0) {
-                        player.isDashing = false;   //stop dash if dash frame runs out
-                    }
-                }
-            }
-
-
-            //BOSS ARENA TELEPORT
-            // Debug teleport key
-            if (IsKeyPressed(KEY_T)) {
-                player.rect.x = bossArenaSpawn.x;
-                player.rect.y = bossArenaSpawn.y;
-                cameraMode = 1; //static camera
-                worldMode = 1; //boss arena background
-
-            }
-            // Jump with W or SPACE
-            if ((IsKeyPressed(KEY_W) || IsKeyPressed(KEY_SPACE)) && light == GREEN_LIGHT) {
-                if (!player.isJumping && onPlatform) {          //Normal Jump
-                    player.velocityY = JUMP_FORCE;
-                    player.isJumping = true;
-                } else if (player.doubleJumpCount > 0 && player.isJumping) {    //double jump
-                    player.velocityY = JUMP_FORCE;
-                    (player.doubleJumpCount)--;
-                } else if (player.isWallSliding) {         // Wall jump
-                    player.velocityY = JUMP_FORCE;
-                    player.isJumping = true;
-                    player.isWallSliding = false;
-
-                    // Add horizontal push-off from wall
-                    if (onRightWall) player.rect.x += 20.0f;  // push right
-                    if (onLeftWall) player.rect.x -= 20.0f; // push left
-                }
-            }
-            if(!player.phaseActive){
-                
-                if (!player.isWallSliding) {    //fast gravity downwards if not sliding (accelerated every frame)
-                    player.velocityY += GRAVITY * player.gravitySign ;
-                    player.rect.y += player.velocityY;
-                }
-                
-                else {
-                    player.velocityY = 1.0f * player.gravitySign;  // slow slide down    (constant velocity, change if necessary)
-                    player.rect.y += player.velocityY;
-                }
-
-            }
-            if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT) && !player.isAttacking) {
-                player_attack_animation1(&player_anim);
-                player.isAttacking = true;
-                player.isDealingDamage = true;
-            }
-            else if (IsMouseButtonPressed(MOUSE_BUTTON_RIGHT) && !player.isAttacking) {
-                player_attack_animation2(&player_anim);
-                player.isAttacking = true;
-                player.isDealingDamage = true;
-            }
-
-            //===============================================================================================//
-
-            // idle animation if standing on platform and not moving/jumping
-            if (!player.isAttacking) {
-                if (onPlatform && !moving && !player.isJumping) {
-                    if (player_anim.row != 0) { 
-                        idle_animation(&player_anim);
-                    }
-                } else {
-                    select_player_animation(moving, player.isJumping, &player_anim);
-                }
-            }
-            animation_update(&player_anim);
-
-            if (player.isAttacking && player_anim.current_frame >= player_anim.last_frame) {
-                player.isAttacking = false;
-                player.isDealingDamage = false;
-                idle_animation(&player_anim);
-            }
-
-            // Check fall out of screen
-            if (player.rect.y > screenHeight + 30) {
-                player.isAlive = false;
-                death_animation(&player_anim);
-            }
-
-            // RED LIGHT: detect any move
-            if(worldMode==0){
-            if (light == RED_LIGHT && (
-                    IsKeyDown(KEY_A) || IsKeyDown(KEY_D) ||
-                    IsKeyDown(KEY_LEFT) || IsKeyDown(KEY_RIGHT) ||
-                    IsKeyDown(KEY_W) || IsKeyDown(KEY_SPACE) ||
-                    IsKeyDown(KEY_LEFT_SHIFT))){
-                if (player.isAlive) {
-                    player.isAlive = false;
-                    death_animation(&player_anim);
-                    
-                }
-            }
-        }
-            for(int i=0;i<DamageBlocks;i++){
-                if (CheckCollisionRecs(player.rect, damageBlock[i])) {
-                player.health--;
-                hit_animation(&player_anim);
-
-                if (player.health == 0) {
-                    
-                    player.isAlive = false;
-                    hit_animation(&player_anim);
-                    death_animation(&player_anim);
-                    
-                } 
-                else {
-                    player.rect.x -= 20; // knockback
-                }
-            }
-        }
-
-
-
-            //======================================Teleport===============================================//
-
-             if (CheckCollisionRecs(player.rect, teleportZoneA) && IsKeyPressed(KEY_UP)) {
-                player.rect.x = teleportZoneB.x;
-                player.rect.y = teleportZoneB.y - player.rect.height;
-            }
-            else if (CheckCollisionRecs(player.rect, teleportZoneB) && IsKeyPressed(KEY_UP)) {
-                player.rect.x = teleportZoneA.x;
-            player.rect.y = teleportZoneA.y - player.rect.height;
-            }
-
-            if (CheckCollisionRecs(player.rect, teleportZoneC) && IsKeyPressed(KEY_UP)) {
-                player.rect.x = teleportZoneD.x;
-                player.rect.y = teleportZoneD.y - player.rect.height;
-            }
-            else if (CheckCollisionRecs(player.rect, teleportZoneD) && IsKeyPressed(KEY_UP)) {
-                player.rect.x = teleportZoneC.x;
-            player.rect.y = teleportZoneC.y - player.rect.height;
-            }
-
-            //======================================Mob Section=======================================//
-
-           //mob hitbox centered on collider
-            for(int i=0; i<MaxMobs; i++){
-            if(mob[i].mobHealth>0){
-            mob[i].hitbox.x = mob[i].collider.x + (mob[i].collider.width - mob[i].hitbox.width) / 2; 
-            mob[i].hitbox.y = mob[i].collider.y + mob[i].collider.height - mob[i].hitbox.height; 
-            if (CheckCollisionRecs(player.rect, mob[i].collider)) {
-                if (!mob[i].isActive) {
-                    mob[i].isActive = true; 
-                    mob[i].timer = EYEBALL_MOB_TIMER; //bug fix: activate mob on first collision 
-                }
-                mob[i].timer -= GetFrameTime();
-
-                if(mob[i].timer <= 0){
-
-                    mob_attack_animation1(&mob_anim);
-                    
-
-                    player.health--; // Player takes damage
-                    hit_animation(&player_anim);
-                    
-                    if (player.health == 0) {
-
-                        
-                        hit_animation(&player_anim);
-                        player.rect.x -= 10; // knockback
-                        death_animation(&player_anim);
-                        player.isAlive = false;
-
-
-                    } else {
-                        player.rect.x -= 10; // knockback
-                    }
-                    mob[i].timer = EYEBALL_MOB_TIMER;
-                    
-                }
-            }
-        }
-    
-            else {
-                mob[i].isActive = false;
-                if( mob_anim.row != 0){
-                    mob_idle_animation(&mob_anim);
-                }
-                
-            }
-        
-        
-        
-
-        //check for player attack
-        if (player.isDealingDamage && mob[i].isAlive && brain.isAlive) {
-        //create an attack box larger than player hitbox
-            Rectangle attackBox = player.rect;
-            attackBox.width += 20.00f;
-
-
-        // Check collision with mob
-            if (CheckCollisionRecs(attackBox, mob[i].hitbox)) {
-                mob[i].mobHealth--; // Damage mob
-                player.isDealingDamage = false; //prevents multiple damage frames
-            }
-
-        }
-    }
-        }
-
-
-        //================================== Eye Ball====================//
-
-        // // Spawn every 5 seconds
-        // dotTimer += GetFrameTime();
-        // if (dotTimer >= 10.0f && !dotActive) {
-        //     dotActive = true;
-        //     dotTimer = 0;
-
-        //     // Fixed spawn (always from left offscreen)
-        //     dotPos = (Vector2){player.rect.x-400,player.rect.y-400};
-
-            
-        // }
-        for (int i = 0; i < MAX_DOTS; i++) {
-    dots[i].timer += GetFrameTime();
-
-    if (dots[i].timer >= 6.0f && !dots[i].active) {
-        float squareHalfSize = 600; // distance from player to edge
-
-// Randomly decide horizontal or vertical edge
-bool horizontal = GetRandomValue(0, 1); // 0=false (vertical), 1=true (horizontal)
-float x, y;
-
-if (horizontal) {
-    y = player.rect.y + (GetRandomValue(0, 1) ? squareHalfSize : -squareHalfSize); // top or bottom
-    x = player.rect.x + GetRandomValue(-squareHalfSize, squareHalfSize);           // random along width
-} else {
-    x = player.rect.x + (GetRandomValue(0, 1) ? squareHalfSize : -squareHalfSize); // left or right
-    y = player.rect.y + GetRandomValue(-squareHalfSize, squareHalfSize);           // random along height
-}
-
-// Assign to dot
-dots[i].pos = (Vector2){x, y};
-dots[i].active = true;
-dots[i].timer = 0;
-    }
-}
-
-Vector2 mouseScreen = GetMousePosition();
-float Scale = (float)GetScreenHeight() / virtualHeight;
-int ScaledWidth = (int)(virtualWidth * Scale);
-int OffsetX = (GetScreenWidth() - ScaledWidth) / 2;
-
-Vector2 mouseVirtual = {
-    (mouseScreen.x - OffsetX) / Scale,
-    mouseScreen.y / Scale
-};
-
-// Convert to world coordinates with camera
-Vector2 mouseWorld = GetScreenToWorld2D(mouseVirtual, camera);
-
-
-        for (int i = 0; i < MAX_DOTS; i++) {
-    if (dots[i].active) {
-        
-        Vector2 playerCenter = {
-            player.rect.x + player.rect.width / 2,
-            player.rect.y + player.rect.height / 2
-        };
-
-        if (dots[i].pos.x < playerCenter.x) dots[i].pos.x += 3.5;
-        if (dots[i].pos.x > playerCenter.x) dots[i].pos.x -= 3.5;
-        if (dots[i].pos.y < playerCenter.y) dots[i].pos.y += 3.5;
-        if (dots[i].pos.y > playerCenter.y) dots[i].pos.y -= 3.5;
-
-      
-        if (CheckCollisionCircles(dots[i].pos, DOT_RADIUS, playerCenter, PLAYER_DRAW_SIZE / 2)) {
-            player.health -= 1;      
-            dots[i].active = false;  // remove the dot
-
-            if (player.health <= 0) {  
-                player.health = 0;      
-                player.isAlive = false; 
-                death_animation(&player_anim);
-            }
-        }
-
-        
-        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON) &&
-        CheckCollisionPointCircle(mouseWorld, dots[i].pos, 20)) {
-        dots[i].active = false;  // destroy dot
-        }   
-
-        Vector2 playerCenter1 = {
-    player.rect.x + player.rect.width / 2,
-    player.rect.y + player.rect.height / 2
-};
-
-float dx = dots[i].pos.x - playerCenter1.x;
-float dy = dots[i].pos.y - playerCenter1.y;
-float distance = sqrtf(dx*dx + dy*dy);
-
-// If too far, deactivate dot so it can respawn
-if (distance > 1200.0f) {
-    dots[i].active = false;
-    dots[i].timer = 0;  // optional: reset timer for respawn logic
-}
-    }
-}
-        
-        
-        //==================================== Animation Updates =======================================//
-        
-        animation_update(&mob_anim);
-        animation_update(&player_anim);
-        animation_update(&boss_anim);
-
-
-
-
-        //==================================== LASER LOGIC =======================================//
-
-
-       // Activate laser when pressing E
-        if (IsKeyPressed(KEY_E) && !laserActive && player.laserAcquired)
-        {
-            laserActive = true;
-            laserTimer = 0.0f;
+        // LEVEL 2, the T key and the arena teleporter all switch worldMode to the arena,
+        // reset switches it back: swap the resident scene art to match
+        SceneId wantedScene = game.worldMode == 1 ? SCENE_ARENA : SCENE_OVERWORLD;
+        if (wantedScene != currentScene) {
+            LeaveScene(&scenes[currentScene]);
+            if (!EnterScene(&scenes[wantedScene], &level)) break;
+            currentScene = wantedScene;
         }
 
-        // Update laser
-        if (laserActive)
-        {
-            laserTimer += GetFrameTime();
-
-            // Follow player position
-            if (player.facingDirection == 1) // right
-            {
-                laserRect.x = player.rect.x + player.rect.width;
-                laserRect.width = laserLength;
-            }
-            else // left
-            {
-                laserRect.x = player.rect.x - laserLength;
-                laserRect.width = laserLength;
-            }
-            laserRect.y = player.rect.y+15;
-            if(player_anim.row == 4){ //if jumping, adjust laser height
-                laserRect.y = player.rect.y+10;
-            }
-            laserRect.height = player.rect.height;
-            laserRect.height = player.rect.height/20;
-
-            if (laserTimer >= laserDuration)
-                laserActive = false; // turn off after duration
+        // walking up to the arena teleporter decodes the arena in the background,
+        // its uploads then trickle in a little per frame
+        if (currentScene == SCENE_OVERWORLD) {
+            if (NearArenaTeleporter(&game)) PrefetchResourceSet(&arena->set);
+            if (arena->set.state == RESOURCE_SET_LOADING) UpdateResourceSet(&arena->set, ASSET_UPLOAD_BUDGET / 4);
         }
+        SceneAssets* scene = &scenes[currentScene];
 
-
-        //====================================== RESET =======================================//
-        
-        if (IsKeyPressed(KEY_R)) {
-            // Reset world mode
-            worldMode = 0; //overworld
-            
-            
-            // Reset player
-            player.rect.x = spawnPoint.x;
-            player.rect.y = spawnPoint.y;
-            player.gravitySign = 1;
-            player.velocityY = 0;
-            player.facingDirection = 1;
-            player.isAlive = true;
-            player.health = 100;
-
-            player.isJumping = false;
-
-            player.doubleJumpCount = 0;
-            player.dashCount = 0;
-            player.isDashing = false;
-
-            //reset mob
-            // Reset mobs after player respawn
-        for (int i = 0; i < MaxMobs; i++) {
-         mob[i].mobHealth = 3;
-         mob[i].isAlive = true;
-         mob[i].isActive = false;
-         mob[i].timer = EYEBALL_MOB_TIMER;
-
-    // Reset collider to the original starting point
-         if (i == 0) { 
-              mob[i].collider.x = 400; 
-              mob[i].collider.y = 50; 
-         }
-          if (i == 1) { 
-             mob[i].collider.x = 1300; 
-             mob[i].collider.y = 210; 
-        }
-           if (i == 2) { 
-             mob[i].collider.x = 2250; 
-             mob[i].collider.y = 250; 
-            }
-            if (i == 3) { 
-             mob[i].collider.x = 3550; 
-             mob[i].collider.y = 100; 
-        }
-           if (i == 4) { 
-             mob[i].collider.x = 4800; 
-             mob[i].collider.y = -150; 
-            }
-             if (i == 5) { 
-             mob[i].collider.x = 5700; 
-             mob[i].collider.y = 40; 
-        }
-           if (i == 6) { 
-             mob[i].collider.x = 6800; 
-             mob[i].collider.y = 260; 
-            }
-            if (i == 7) { 
-             mob[i].collider.x = 8400; 
-             mob[i].collider.y = 100; 
-        }
-           if (i == 8) { 
-             mob[i].collider.x = 9500; 
-             mob[i].collider.y = 150; 
-            }
-             if (i == 9) { 
-             mob[i].collider.x = 11500; 
-             mob[i].collider.y = 200; 
-        }
-           if (i == 10) { 
-             mob[i].collider.x = 13830; 
-             mob[i].collider.y = 50; 
-            }
-         
-
-          // Recalculate hitbox relative to collider
-          mob[i].hitbox.x = mob[i].collider.x + (mob[i].collider.width - mob[i].hitbox.width) / 2; 
-          mob[i].hitbox.y = mob[i].collider.y + mob[i].collider.height - mob[i].hitbox.height;
-        }
-
-            // Reset animation to idle
-            idle_animation(&player_anim);
-
-            // Reset camera target
-            
-
-            //reset double jumps
-            for (int i = 0; i < DOUBLE_JUMPS; i++) {
-                Djumps[i].isCollected = false;
-            }
-            for (int i = 0; i < DASHES; i++) {
-                Dashes[i].isCollected = false;
-            }
-            for( int i=0 ; i<LEVITATION; i++){
-                Levitations[i].isCollected = false;
-            }
-            for( int i=0 ; i<NOCLIP; i++){
-                Noclips[i].isCollected = false;
-            }
-        }
-
-
-        if (IsKeyPressed(KEY_R)) {
-            // Reset world mode
-             //overworld
-            
-            
-            // Reset player
-            brain.brainHealth = 100;
-        brain.isAlive = true;
-            if(worldMode==0){
-            player.rect.x = spawnPoint.x;
-            player.rect.y = spawnPoint.y;
-            cameraMode = 0; //dynamic camera
-            
-            }
-            if(worldMode==1){
-                player.rect.x = bossArenaSpawn.x;
-                player.rect.y = bossArenaSpawn.y;
-                cameraMode = 1; //static camera
-            }
-            player.gravitySign = 1;
-            player.velocityY = 0;
-            player.facingDirection = 1;
-            player.isAlive = true;
-            player.health = 100;
-
-            player.isJumping = false;
-
-            player.doubleJumpCount = 0;
-            player.dashCount = 0;
-            player.isDashing = false;
-
-            //reset mob
-            
-            
-            // Reset animation to idle
-            idle_animation(&player_anim);
-
-            // Reset camera target
-            
-
-            //reset double jumps
-            for (int i = 0; i < DOUBLE_JUMPS; i++) {
-                Djumps[i].isCollected = false;
-            }
-            for (int i = 0; i < DASHES; i++) {
-                Dashes[i].isCollected = false;
-            }
-            for( int i=0 ; i<LEVITATION; i++){
-                Levitations[i].isCollected = false;
-            }
-            for( int i=0 ; i<NOCLIP; i++){
-                Noclips[i].isCollected = false;
-            }
-        }
-        for (int i = 0; i < CheckPointcount; i++) {
-            if (CheckCollisionRecs(player.rect, Checkpoint[i])) {
-                spawnPoint.x = Checkpoint[i].x;
-                spawnPoint.y = Checkpoint[i].y;
-            }
-        }
-        
-        
-        
-        
-        
-        
-
-  
-
-        // Update camera to follow player
-        if(cameraMode == 0) { //dynamic camera
-            camera.target = (Vector2){player.rect.x + player.rect.width / 2, player.rect.y + player.rect.height / 2};
-        }
-        else if (cameraMode == 1) { //static camera for boss arena
-            camera.target = (Vector2){bossArenaSpawn.x, bossArenaSpawn.y};
-        }
+        // Render state: interpolate between the previous and current simulation step
+        float alpha = accumulator / SIM_DT;
+        Rectangle playerDrawRect = interpolate_rect(prevPlayerRect, game.player.rect, alpha);
+        Rectangle brainDrawRect = interpolate_rect(prevBrainRect, game.brain.position, alpha);
+        Vector2 dotDrawPos[MAX_DOTS];
+        for (int i = 0; i < MAX_DOTS; i++) dotDrawPos[i] = interpolate_position(prevDotPos[i], game.dots[i].pos, alpha);
+        Camera2D renderCamera = game.camera;
+        renderCamera.target = interpolate_position(prevCameraTarget, game.camera.target, alpha);
 
 
 
@@ -2264,17 +453,23 @@ if (distance > 1200.0f) {
         
        
         
+        // Visibility pass: world-space view of the virtual target, computed once per frame
+        Rectangle cameraView = GetCameraViewRect(renderCamera, virtualWidth, virtualHeight);
+        CullStats cullStats = {0};
+
+        PROFILE_BEGIN(PROFILE_WORLD_DRAW);
         BeginTextureMode(target);
         ClearBackground(RAYWHITE);
 
         // Draw Worlds
-        if (gamestarted)
+        if (game.started)
         {
-            if (player.isAlive)
+            if (game.player.isAlive)
             {
                 // Overworld background
-                if (worldMode == 0)
+                if (game.worldMode == 0)
                 {
+                    Texture2D boss_background = overworld->set.textures[bossBackgroundSlot];
                     DrawTexturePro(
                         boss_background,
                         (Rectangle){0, 0, boss_background.width, boss_background.height},
@@ -2283,23 +478,12 @@ if (distance > 1200.0f) {
                         0.0f,
                         WHITE
                     );
-
-                    // Boss animation overlay
-                    Texture2D current_boss_tex = (light == GREEN_LIGHT) ? boss_sleep_texture : boss_awake_texture;
-                    Rectangle boss_frame = animation_frame(&boss_anim, boss_max_frames, boss_num_rows, current_boss_tex);
-                    DrawTexturePro(
-                        current_boss_tex,
-                        boss_frame,
-                        (Rectangle){0, 0, (float)virtualWidth, (float)virtualHeight},
-                        (Vector2){0, 0},
-                        0.0f,
-                        WHITE
-                    );
                 }
 
                 // Boss arena background
-                if (worldMode == 1)
+                if (game.worldMode == 1)
                 {
+                    Texture2D boss_arena_background = arena->set.textures[arenaBackgroundSlot];
                     DrawTexturePro(
                         boss_arena_background,
                         (Rectangle){0, 0, boss_arena_background.width, boss_arena_background.height},
@@ -2311,79 +495,19 @@ if (distance > 1200.0f) {
                 }
 
                 // Begin camera 2D mode
-                BeginMode2D(camera);
-
-                 DrawTilemap(tileset, 5, 5, platform1, 100, 345, TILE_SIZE);
-        DrawTilemap(tileset, 6, 4, platform2, 200, 280, TILE_SIZE);
-        DrawTilemap(tileset, 6, 6, platform3, 400, 100, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform4, 700, 150, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform5, 900, 250, TILE_SIZE);
-        DrawTilemap(tileset, 5, 5, platform6, 1300, 260, TILE_SIZE);
-        DrawTilemap(tileset, 5, 6, platform7, 1700, 100, TILE_SIZE);
-        DrawTilemap(tileset, 5, 5, platform8, 2100, 200, TILE_SIZE);
-        DrawTilemap(tileset, 5, 5, platform9, 2250, 300, TILE_SIZE);
-        DrawTilemap(tileset, 5, 6, platform10, 2650, 250, TILE_SIZE);
-        DrawTilemap(tileset, 4, 5, platform11, 2800, 200, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform12, 3150, 50, TILE_SIZE);
-        DrawTilemap(tileset, 5, 6, platform13, 3550, 150, TILE_SIZE);
-        DrawTilemap(tileset, 5, 5, platform14, 4000, 180, TILE_SIZE);
-        DrawTilemap(tileset, 4, 5, platform15, 4350, 100, TILE_SIZE);
-        DrawTilemap(tileset, 3, 4, platform16, 4500, 140, TILE_SIZE);
-        DrawTilemap(tileset, 3, 6, platform17, 4800, -100, TILE_SIZE);
-        DrawTilemap(tileset, 4, 7, platform18, 4950, -200, TILE_SIZE);
-        DrawTilemap(tileset, 5, 5, platform19, 5275, 50, TILE_SIZE);
-        DrawTilemap(tileset, 4, 6, platform20, 5700, 90, TILE_SIZE);
-        DrawTilemap(tileset, 8, 18, platform21, 6100, 60, TILE_SIZE); 
-        DrawTilemap(tileset, 7, 10, platform22, 6800, 310, TILE_SIZE);
-        DrawTilemap(tileset, 5, 8, platform23, 7200, 130, TILE_SIZE);
-        DrawTilemap(tileset, 2, 5, platform24, 6200, 500, TILE_SIZE);
-        DrawTilemap(tileset, 4, 6, platform25, 7500, 400, TILE_SIZE);
-        DrawTilemap(tileset, 3, 4, platform26, 7800, 300, TILE_SIZE);
-        DrawTilemap(tileset, 3, 5, platform27, 8100, 400, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform28, 8400, 150, TILE_SIZE);
-        DrawTilemap(tileset, 3, 5, platform29, 8570, 190, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform30, 8900, 350, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform31, 9070, 280, TILE_SIZE);
-        DrawTilemap(tileset, 4, 6, platform32, 9500, 200, TILE_SIZE);
-        DrawTilemap(tileset, 4, 5, platform33, 9800, 100, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform34, 10100, 250, TILE_SIZE);
-        DrawTilemap(tileset, 3, 5, platform35, 10300, 300, TILE_SIZE);
-        DrawTilemap(tileset, 4, 6, platform36, 10700, 200, TILE_SIZE);
-        DrawTilemap(tileset, 4, 7, platform37, 11100, 100, TILE_SIZE);
-        DrawTilemap(tileset, 4, 8, platform38, 11500, 250, TILE_SIZE);
-        DrawTilemap(tileset, 4, 6, platform39, 11700, 160, TILE_SIZE);
-
+                BeginMode2D(renderCamera);
 
-
-            
-                // BOSS ARENA WALLS
-            
-                DrawTilemap(boss_arena_tileset, 32, 32, platform40, 20000, -20000, TILE_SIZE);
-                DrawTilemap(boss_arena_tileset, 32, 32, platform41, 20000-1024, -20000-1024+200, TILE_SIZE);
-                
-                DrawTilemap(boss_arena_tileset, 32, 32, platform42, 20000+1024, -20000-1024+200, TILE_SIZE);
-                
-                DrawTilemap(boss_arena_tileset, 3, 3, platform43, 20000+928, -20000-200, TILE_SIZE);
-                DrawTilemap(boss_arena_tileset, 3, 4, platform44, 20000+928-300, -20000-200-150, TILE_SIZE);
-                //{20000+928-300, -20000-200-150, 96, 128}
-
-                DrawTilemap(boss_arena_tileset, 3, 3, platform43, 20000, -20000-200, TILE_SIZE);
-                DrawTilemap(boss_arena_tileset, 3, 4, platform44, 20000+250, -20000-200-150, TILE_SIZE);
-
-
-                //
-                  DrawTilemap(tileset, 4, 3, platform60, 12000, 350, TILE_SIZE);
-                  DrawTilemap(tileset, 7, 10, platform61, 12000, 600, TILE_SIZE);
-                  DrawTilemap(tileset, 6, 3, platform62, 12550, 450, TILE_SIZE);
-                  DrawTilemap(tileset, 6, 3, platform63, 12450, 200, TILE_SIZE);
-                  DrawTilemap(tileset, 6, 3, platform64, 12550, -50, TILE_SIZE);
-                  DrawTilemap(tileset, 3, 6, platform65, 12900, 0, TILE_SIZE);
-                  DrawTilemap(tileset, 4, 8, platform66, 13250, -100, TILE_SIZE);
-                  DrawTilemap(tileset, 5, 8, platform67, 13800, 100, TILE_SIZE);
-                  DrawTilemap(tileset, 4, 5, platform68, 14000, 210, TILE_SIZE);
-                  DrawTilemap(tileset, 4, 9, platform69, 14400, 170, TILE_SIZE);
-
-                  DrawTilemap(tileset, 8, 3, platform70, 3230,  -210, TILE_SIZE);
+                // Static tile layers, one quad per visible layer (or pre-baked chunks)
+                if (scene->useGpuTiles) {
+                    int layersDrawn = DrawGpuTileMap(&scene->gpuTiles, cameraView, TILE_SIZE);
+                    cullStats.drawn += layersDrawn;
+                    cullStats.culled += scene->gpuTiles.layerCount - layersDrawn;
+                }
+                else {
+                    int chunksDrawn = DrawTileChunks(&scene->chunks, cameraView);
+                    cullStats.drawn += chunksDrawn;
+                    cullStats.culled += scene->chunks.count - chunksDrawn;
+                }
 
         
         
@@ -2397,30 +521,14 @@ if (distance > 1200.0f) {
         
 
                 // Draw damage block
-                for (int i = 0; i < DamageBlocks; i++)
+                for (int i = 0; i < game.damageBlockCount; i++)
                 {
-                    DrawTexturePro(damage_block_texture,
-                        (Rectangle){0, 0, damage_block_texture.width, damage_block_texture.height},
-                        (Rectangle){damageBlock[i].x, damageBlock[i].y, damageBlock[i].width, damageBlock[i].height},
-                        (Vector2){0, 0}, 0.0f, WHITE);
+                    if (!IsVisible(&cullStats, cameraView, game.damageBlock[i])) continue;
+                    DrawSprite(&sprites, SPRITE_DAMAGE_BLOCK, game.damageBlock[i], WHITE);
                 }
 
 
 
-            
-                // BOSS ARENA WALLS
-            
-                DrawTilemap(boss_arena_tileset, 32, 32, platform40, 20000, -20000, TILE_SIZE);
-                DrawTilemap(boss_arena_tileset, 32, 32, platform41, 20000-1024, -20000-1024+200, TILE_SIZE);
-                
-                DrawTilemap(boss_arena_tileset, 32, 32, platform42, 20000+1024, -20000-1024+200, TILE_SIZE);
-                
-                DrawTilemap(boss_arena_tileset, 3, 3, platform43, 20000+928, -20000-200, TILE_SIZE);
-                DrawTilemap(boss_arena_tileset, 3, 4, platform44, 20000+928-300, -20000-200-150, TILE_SIZE);
-                //{20000+928-300, -20000-200-150, 96, 128}
-
-                DrawTilemap(boss_arena_tileset, 3, 3, platform43, 20000, -20000-200, TILE_SIZE);
-                DrawTilemap(boss_arena_tileset, 3, 4, platform44, 20000+250, -20000-200-150, TILE_SIZE);
 
 
                 //Draw Teleporter
@@ -2441,12 +549,10 @@ if (distance > 1200.0f) {
                 // );
 
                 //Draw NPC
-                DrawTexturePro(
-                    wizard_texture,
-                    (Rectangle){0, 0, wizard_texture.width, wizard_texture.height},
-                    (Rectangle){5800+130, 150-80, 64, 64},
-                    (Vector2){0, 0}, 0.0f, WHITE
-                );
+                Rectangle wizardRect = {5800+130, 150-80, 64, 64};
+                if (IsVisible(&cullStats, cameraView, wizardRect)) {
+                    DrawSprite(&sprites, SPRITE_WIZARD, wizardRect, WHITE);
+                }
                 // Full Screen EYEBALL fix
                 // Vector2 mouseScreen = GetMousePosition();
                 // float scale = (float)GetScreenHeight() / virtualHeight;
@@ -2481,15 +587,10 @@ if (distance > 1200.0f) {
                 // }    
 
                 for (int i = 0; i < MAX_DOTS; i++) {
-    if (dots[i].active) {
-        DrawTexturePro(
-            eyeball,
-            (Rectangle){0, 0, eyeball.width, eyeball.height},
-            (Rectangle){dots[i].pos.x - DOT_RADIUS, dots[i].pos.y - DOT_RADIUS, DOT_RADIUS * 2, DOT_RADIUS * 2},
-            (Vector2){0, 0},
-            0.0f,
-            WHITE
-        );
+    if (game.dots[i].active) {
+        Rectangle dotRect = {dotDrawPos[i].x - DOT_RADIUS, dotDrawPos[i].y - DOT_RADIUS, DOT_RADIUS * 2, DOT_RADIUS * 2};
+        if (!IsVisible(&cullStats, cameraView, dotRect)) continue;
+        DrawSprite(&sprites, SPRITE_EYEBALL, dotRect, WHITE);
     }
 }
 
@@ -2505,110 +606,79 @@ if (distance > 1200.0f) {
 
                
                 // Draw collectibles
-                for (int i = 0; i < DOUBLE_JUMPS; i++)
+                for (int i = 0; i < game.djumpCount; i++)
                 {
-                    if (!Djumps[i].isCollected)
+                    if (!game.Djumps[i].isCollected && IsVisible(&cullStats, cameraView, game.Djumps[i].rect))
                     {
-                        DrawTexturePro(double_jump_texture,
-                                    (Rectangle){0, 0, double_jump_texture.width, double_jump_texture.height},
-                                    Djumps[i].rect,
-                                    (Vector2){0, 0}, 0.0f, WHITE);
+                        DrawSprite(&sprites, SPRITE_DOUBLE_JUMP, game.Djumps[i].rect, WHITE);
                     }
                 }
 
-                for (int i = 0; i < DASHES; i++)
+                for (int i = 0; i < game.dashCount; i++)
                 {
-                    if (!Dashes[i].isCollected)
+                    if (!game.Dashes[i].isCollected && IsVisible(&cullStats, cameraView, game.Dashes[i].rect))
                     {
-                        DrawTexturePro(dash_texture,
-                                    (Rectangle){0, 0, dash_texture.width, dash_texture.height},
-                                    Dashes[i].rect,
-                                    (Vector2){0, 0}, 0.0f, WHITE);
+                        DrawSprite(&sprites, SPRITE_DASH, game.Dashes[i].rect, WHITE);
                     }
                 }
 
-                for (int i = 0; i < LEVITATION; i++)
+                for (int i = 0; i < game.levitationCount; i++)
                 {
-                    if (!Levitations[i].isCollected)
+                    if (!game.Levitations[i].isCollected && IsVisible(&cullStats, cameraView, game.Levitations[i].rect))
                     {
-                        DrawTexturePro(levitation_texture,
-                                    (Rectangle){0, 0, levitation_texture.width, levitation_texture.height},
-                                    Levitations[i].rect,
-                                    (Vector2){0, 0}, 0.0f, WHITE);
+                        DrawSprite(&sprites, SPRITE_LEVITATION, game.Levitations[i].rect, WHITE);
                     }
                 }
 
-                for(int i = 0; i< NOCLIP; i++){
-                    if(!Noclips[i].isCollected){
+                for(int i = 0; i< game.noclipCount; i++){
+                    if(!game.Noclips[i].isCollected && IsVisible(&cullStats, cameraView, game.Noclips[i].rect)){
                          //DrawRectangleRec(Noclips[i].rect, RED);
-                         DrawTexturePro(phase_texture,
-                                    (Rectangle){0, 0, phase_texture.width, phase_texture.height},
-                                    Noclips[i].rect,
-                                    (Vector2){0, 0}, 0.0f, WHITE);
+                         DrawSprite(&sprites, SPRITE_PHASE, game.Noclips[i].rect, WHITE);
                     }
                 }
 
                 // Draw player
-                Rectangle frame = animation_frame(&player_anim, max_frames, num_rows, player_texture);
-                frame.width *= direction;
-                DrawTexturePro(player_texture,
-                            frame,
-                            (Rectangle){player.rect.x + player.rect.width / 2 - PLAYER_DRAW_SIZE / 2,
-                                        player.rect.y + player.rect.height / 2 - PLAYER_DRAW_SIZE / 2,
-                                        PLAYER_DRAW_SIZE * direction,
+                SheetFrame frame = animation_sheet_frame(&game.player_anim, &player_sheet);
+                DrawSheetFrame(&player_sheet, frame,
+                            (Rectangle){playerDrawRect.x + playerDrawRect.width / 2 - PLAYER_DRAW_SIZE / 2,
+                                        playerDrawRect.y + playerDrawRect.height / 2 - PLAYER_DRAW_SIZE / 2,
+                                        PLAYER_DRAW_SIZE,
                                         PLAYER_DRAW_SIZE},
-                            (Vector2){0, 0}, 0.0f, WHITE);
+                            game.direction < 0, WHITE);
 
                 // Draw mob
-                for(int i=0;i<MaxMobs;i++){
-                    if(mob[i].mobHealth>0){
-                        Rectangle mob_frame = animation_frame(&mob_anim, mob_max_frames, mob_num_rows, mob_texture);
-                        DrawTexturePro(mob_texture,
-                                    mob_frame,
-                                    (Rectangle){mob[i].hitbox.x + mob[i].hitbox.width / 2 - MOB_DRAW_SIZE / 2,
-                                                mob[i].hitbox.y + mob[i].hitbox.height / 2 - MOB_DRAW_SIZE / 2,
-                                                MOB_DRAW_SIZE * direction,
-                                                MOB_DRAW_SIZE - 50},
-                                    (Vector2){0, 0}, 0.0f, WHITE);
-                    }
-                
-                if (mob[i].mobHealth > 0)
-                {
-                    Rectangle mob_frame = animation_frame(&mob_anim, mob_max_frames, mob_num_rows, mob_texture);
-                    DrawTexturePro(mob_texture,
-                                mob_frame,
-                                (Rectangle){mob[i].hitbox.x + mob[i].hitbox.width / 2 - MOB_DRAW_SIZE / 2,
-                                            mob[i].hitbox.y + mob[i].hitbox.height / 2 - MOB_DRAW_SIZE / 2,
-                                            MOB_DRAW_SIZE * direction,
-                                            MOB_DRAW_SIZE - 50},
-                                (Vector2){0, 0}, 0.0f, WHITE);
-                }
+                for(int i=0;i<game.mobs.count;i++){
+                    Rectangle mobDest = {game.mobs.hitbox[i].x + game.mobs.hitbox[i].width / 2 - MOB_DRAW_SIZE / 2,
+                                         game.mobs.hitbox[i].y + game.mobs.hitbox[i].height / 2 - MOB_DRAW_SIZE / 2,
+                                         MOB_DRAW_SIZE,
+                                         MOB_DRAW_SIZE - 50};
+                    if (!IsVisible(&cullStats, cameraView, mobDest)) continue;
+
+                    SheetFrame mob_frame = animation_sheet_frame(&game.mobs.anim[i], &mob_sheet);
+                    DrawSheetFrame(&mob_sheet, mob_frame, mobDest, false, WHITE);
             }
                 // Brain drawing
-                if (brain.brainHealth > 0 && worldMode == 1)
+                if (game.brain.brainHealth > 0 && game.worldMode == 1)
                 {
-                    Vector2 brainCenter = {brain.position.x + brain.position.width / 2,
-                                        brain.position.y + brain.position.height / 2};
-
-                    DrawTexturePro(brain_texture,
-                                (Rectangle){0, 0, brain_texture.width, brain_texture.height},
-                                (Rectangle){brainCenter.x - brain_texture.width / 2,
-                                            brainCenter.y - brain_texture.height / 2,
-                                            brain_texture.width,
-                                            brain_texture.height},
-                                (Vector2){0, 0}, 0.0f, WHITE);
+                    Vector2 brainCenter = {brainDrawRect.x + brainDrawRect.width / 2,
+                                        brainDrawRect.y + brainDrawRect.height / 2};
+                    Rectangle brainSprite = sprites.rects[SPRITE_BRAIN];
+                    Rectangle brainDest = {brainCenter.x - brainSprite.width / 2,
+                                           brainCenter.y - brainSprite.height / 2,
+                                           brainSprite.width,
+                                           brainSprite.height};
+
+                    if (IsVisible(&cullStats, cameraView, brainDest))
+                        DrawSprite(&sprites, SPRITE_BRAIN, brainDest, WHITE);
                 }
 
                 // Draw laser
-                if (laserActive)
-                    DrawRectangleRec(laserRect, WHITE);
-                if (laserActive && brain.isAlive)
-                {
-                    Vector2 brainCenter = {brain.position.x + brain.position.width / 2,
-                                        brain.position.y + brain.position.height / 2};
-                    float brainRadius = brain.position.width / 2;
-                    if (CheckCollisionCircleRec(brainCenter, brainRadius, laserRect))
-                        if (brain.brainHealth > 0) brain.brainHealth--;
+                if (game.laserActive) {
+                    Rectangle laserDrawRect = game.laserRect;
+                    laserDrawRect.x += playerDrawRect.x - game.player.rect.x;    // laser is attached to the player
+                    laserDrawRect.y += playerDrawRect.y - game.player.rect.y;
+                    if (IsVisible(&cullStats, cameraView, laserDrawRect))
+                        DrawRectangleRec(laserDrawRect, WHITE);
                 }
 
                 EndMode2D(); // End camera mode
@@ -2616,8 +686,10 @@ if (distance > 1200.0f) {
         } // player.isAlive & gamestarted
 
         EndTextureMode();
+        PROFILE_END(PROFILE_WORLD_DRAW);
 
         // Draw to screen
+        PROFILE_BEGIN(PROFILE_BLIT);
         BeginDrawing();
         ClearBackground(BLACK);
 
@@ -2631,32 +703,37 @@ if (distance > 1200.0f) {
                     (Rectangle){0, 0, (float)target.texture.width, -(float)target.texture.height},
                     (Rectangle){offsetX, offsetY, scaledWidth, scaledHeight},
                     (Vector2){0, 0}, 0.0f, WHITE);
+        PROFILE_END(PROFILE_BLIT);
 
         // HUD
-        DrawText(TextFormat("Health: %d", player.health), 20, 20, 30, WHITE);
+        PROFILE_BEGIN(PROFILE_HUD);
+        DrawText(TextFormat("Health: %d", game.player.health), 20, 20, 30, WHITE);
+#ifdef DEBUG
+        DrawText(TextFormat("Drawn: %d  Culled: %d", cullStats.drawn, cullStats.culled), 20, 55, 20, WHITE);
+#endif
 
-        if (worldMode == 1 && brain.brainHealth > 0)
+        if (game.worldMode == 1 && game.brain.brainHealth > 0)
         {
             int maxHealth = 100;
             float barWidth = 400;
             float barHeight = 25;
             float barX = GetScreenWidth() / 2 - barWidth / 2;
             float barY = 20;
-            float currentWidth = (brain.brainHealth / (float)maxHealth) * barWidth;
+            float currentWidth = (game.brain.brainHealth / (float)maxHealth) * barWidth;
             DrawRectangle(barX, barY, barWidth, barHeight, DARKGRAY);
             DrawRectangle(barX, barY, currentWidth, barHeight, RED);
             DrawRectangleLines(barX, barY, barWidth, barHeight, BLACK);
         }
-        if (showDialogue)
+        if (game.showDialogue)
         {
                 Rectangle dialogueBox = { GetScreenWidth()/2 - 300, GetScreenHeight()/2 + 100, 800, 200 }; // bottom of screen
                 DrawRectangleRec(dialogueBox, BLACK);
                 DrawRectangleLines(dialogueBox.x, dialogueBox.y, dialogueBox.width, dialogueBox.height, WHITE);
-                if(player.laserAcquired == true)
+                if(game.player.laserAcquired == true)
                 {
                     DrawText(dialogueText1, dialogueBox.x + 10, dialogueBox.y + 10, 20, WHITE);
                 }
-                else if(player.laserAcquired == false)
+                else if(game.player.laserAcquired == false)
                 {
                     DrawText(dialogueText2, dialogueBox.x + 10, dialogueBox.y + 10, 20, WHITE);
                 }
@@ -2664,7 +741,7 @@ if (distance > 1200.0f) {
         }
 
         // Game over
-        if (!player.isAlive)
+        if (!game.player.isAlive)
         {
             DrawText("GAME OVER",
                     GetScreenWidth() / 2 - MeasureText("GAME OVER", 40) / 2,
@@ -2676,7 +753,7 @@ if (distance > 1200.0f) {
         }
 
         // Menu buttons if game not started
-        if (!gamestarted)
+        if (!game.started)
         {
             playButton.x = GetScreenWidth()/2 - playButton.width/2;
             quitbutton.x = GetScreenWidth()/2 - quitbutton.width/2;
@@ -2691,14 +768,36 @@ if (distance > 1200.0f) {
             DrawText("LEVEL 2", playButton2.x + 10, playButton2.y + 10, 20, BLACK);
             DrawText("QUIT", quitbutton.x + 20, quitbutton.y + 10, 20, BLACK);
         }
+        PROFILE_END(PROFILE_HUD);
+
+#if PROFILER_ENABLED
+        if (showProfiler) DrawProfilerOverlay(GetScreenWidth() - 310, 10);
+#endif
 
+        PROFILE_BEGIN(PROFILE_PRESENT);
         EndDrawing();
+        PROFILE_END(PROFILE_PRESENT);
+        PROFILE_FRAME_END();
 
     }
 
-    UnloadTexture(player_texture);
-    UnloadSound(awake_fx);
+shutdown:
+    for (int i = 0; i < SCENE_COUNT; i++) LeaveScene(&scenes[i]);
+    UnloadSpriteAtlas(&sprites);
+    game_shutdown(&game);
+    UnloadLevel(&level);
+    EndReplay(&playback);
+    EndReplay(&recording);
+    ReleaseResource(player_handle);
+    ReleaseResource(mob_handle);
+    UntrackRenderTexture("render target", target);
+    UnloadRenderTexture(target);
+    StopAudioMixer();
+    ShutdownResources();
     CloseAudioDevice();
     CloseWindow();
-    return 0;
+    StopJobWorkers();
+    EndTraceCapture();
+    UnmountPak();
+    return status;
 }
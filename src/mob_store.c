@@ -0,0 +1,71 @@
+#include "mob_store.h"
+#include <string.h>
+
+static void FreeAllIds(MobStore* store) {
+    store->count = 0;
+    store->freeCount = 0;
+    for (int id = MAX_MOBS - 1; id >= 0; id--) {
+        store->slot[id] = -1;
+        store->freeIds[store->freeCount++] = id;
+    }
+}
+
+void InitMobStore(MobStore* store) {
+    memset(store, 0, sizeof(*store));
+    FreeAllIds(store);
+}
+
+void ClearMobs(MobStore* store) {
+    for (int i = 0; i < store->count; i++) store->generation[store->id[i]]++;
+    FreeAllIds(store);
+}
+
+MobHandle SpawnMob(MobStore* store, Rectangle collider, Rectangle hitbox, int health, float timer, Animation anim) {
+    if (store->freeCount == 0) return (MobHandle){0};
+
+    int id = store->freeIds[--store->freeCount];
+    int slot = store->count++;
+    if (store->generation[id] == 0) store->generation[id] = 1;
+
+    store->collider[slot] = collider;
+    store->hitbox[slot] = hitbox;
+    store->health[slot] = health;
+    store->timer[slot] = timer;
+    store->isActive[slot] = false;
+    store->anim[slot] = anim;
+    store->id[slot] = id;
+    store->slot[id] = slot;
+    return (MobHandle){ id, store->generation[id] };
+}
+
+int GetMobSlot(const MobStore* store, MobHandle handle) {
+    if (handle.generation == 0 || handle.id < 0 || handle.id >= MAX_MOBS) return -1;
+    return store->generation[handle.id] == handle.generation ? store->slot[handle.id] : -1;
+}
+
+MobHandle GetMobById(const MobStore* store, int id) {
+    if (id < 0 || id >= MAX_MOBS || store->slot[id] < 0) return (MobHandle){0};
+    return (MobHandle){ id, store->generation[id] };
+}
+
+void DespawnMob(MobStore* store, MobHandle handle) {
+    int slot = GetMobSlot(store, handle);
+    if (slot < 0) return;
+
+    // the last mob moves into the hole, its id now points there
+    int last = --store->count;
+    if (slot != last) {
+        store->collider[slot] = store->collider[last];
+        store->hitbox[slot] = store->hitbox[last];
+        store->health[slot] = store->health[last];
+        store->timer[slot] = store->timer[last];
+        store->isActive[slot] = store->isActive[last];
+        store->anim[slot] = store->anim[last];
+        store->id[slot] = store->id[last];
+        store->slot[store->id[slot]] = slot;
+    }
+
+    store->slot[handle.id] = -1;
+    store->generation[handle.id]++;
+    store->freeIds[store->freeCount++] = handle.id;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "raylib.h"
+#include "animation.h"
+#include <stdbool.h>
+
+#define MAX_MOBS 1024       // mobs alive at once
+
+// Names a mob for as long as it lives. Slots move when other mobs despawn, ids don't;
+// the generation keeps a handle held past a despawn from finding the id's next mob.
+// A zeroed handle is never valid.
+typedef struct MobHandle {
+    int id;
+    unsigned int generation;
+} MobHandle;
+
+// Live mobs as parallel arrays over slots [0, count), so a pass over one property walks
+// one contiguous array. Despawning moves the last mob into the freed slot.
+typedef struct MobStore {
+    int count;
+    Rectangle collider[MAX_MOBS];   // aggro area
+    Rectangle hitbox[MAX_MOBS];
+    int health[MAX_MOBS];
+    float timer[MAX_MOBS];          // until the next bite while the player is in reach
+    bool isActive[MAX_MOBS];        // player has been in reach since spawning
+    Animation anim[MAX_MOBS];
+    int id[MAX_MOBS];               // handle id of the mob in each slot
+
+    // by handle id
+    int slot[MAX_MOBS];             // -1 while the id is free
+    unsigned int generation[MAX_MOBS];
+    int freeIds[MAX_MOBS];          // stack, lowest id on top after a clear
+    int freeCount;
+} MobStore;
+
+void InitMobStore(MobStore* store);
+
+// Despawns every mob; ids are handed out from 0 again, under new generations
+void ClearMobs(MobStore* store);
+
+// Zeroed handle when the store is full. The mob starts inactive.
+MobHandle SpawnMob(MobStore* store, Rectangle collider, Rectangle hitbox, int health, float timer, Animation anim);
+
+// Harmless on a stale handle
+void DespawnMob(MobStore* store, MobHandle handle);
+
+// Slot of a live mob, -1 for a stale handle
+int GetMobSlot(const MobStore* store, MobHandle handle);
+
+// Live mob currently holding the id, or a zeroed handle
+MobHandle GetMobById(const MobStore* store, int id);
@@ -0,0 +1,50 @@
+#include "options.h"
+#include <stdlib.h>
+#include <string.h>
+
+void ParseLaunchOptions(int argc, char** argv, LaunchOptions* options) {
+    memset(options, 0, sizeof(*options));
+    options->steps = 60 * 60;   // one minute of game time
+    options->level = 1;
+    options->input = HEADLESS_INPUT_SCRIPT;
+
+    for (int i = 1; i < argc; i++) {
+        bool hasValue = i + 1 < argc;
+
+        if (strcmp(argv[i], "--headless") == 0) {
+            options->headless = true;
+        }
+        else if (strcmp(argv[i], "--steps") == 0 && hasValue) {
+            options->steps = atoll(argv[++i]);
+        }
+        else if (strcmp(argv[i], "--level") == 0 && hasValue) {
+            options->level = atoi(argv[++i]) == 2 ? 2 : 1;
+        }
+        else if (strcmp(argv[i], "--input") == 0 && hasValue) {
+            i++;
+            options->input = strcmp(argv[i], "idle") == 0 ? HEADLESS_INPUT_IDLE : HEADLESS_INPUT_SCRIPT;
+        }
+        else if (strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options->hasSeed = true;
+            options->seed = (uint32_t)strtoul(argv[++i], NULL, 10);
+        }
+        else if (strcmp(argv[i], "--record") == 0 && hasValue) {
+            options->recordPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--replay") == 0 && hasValue) {
+            options->replayPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--map") == 0 && hasValue) {
+            options->levelPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--trace") == 0 && hasValue) {
+            options->tracePath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--pak") == 0 && hasValue) {
+            options->pakPath = argv[++i];
+        }
+        else if (strcmp(argv[i], "--music") == 0 && hasValue) {
+            options->musicPath = argv[++i];
+        }
+    }
+}
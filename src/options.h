@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef enum HeadlessInput {
+    HEADLESS_INPUT_IDLE = 0,    // no buttons held, the world runs around a standing player
+    HEADLESS_INPUT_SCRIPT,      // fixed run/jump/dash/attack pattern, respawns on death
+} HeadlessInput;
+
+// Command line switches
+//   --headless              run the simulation without a window, GL context or audio device
+//   --steps N               headless: steps to run (default one minute of game time)
+//   --level 1|2             headless: overworld or boss arena
+//   --input idle|script     headless: generated input when not replaying
+//   --seed N                gameplay RNG seed (windowed default: time based, headless: 1)
+//   --record FILE           record every simulation step's input to FILE
+//   --replay FILE           feed FILE back instead of live input (uses the recorded seed)
+//   --map FILE              level file to load (default assets/levels/world.lvl)
+//   --trace FILE            write a Chrome trace (chrome://tracing, Perfetto) of the session
+//   --music FILE            stream FILE as background music
+//   --pak FILE              asset archive to mount (default assets.pak next to the game, if any)
+typedef struct LaunchOptions {
+    bool headless;
+    long long steps;
+    int level;
+    HeadlessInput input;
+    bool hasSeed;
+    uint32_t seed;
+    const char* recordPath;
+    const char* replayPath;
+    const char* levelPath;
+    const char* tracePath;
+    const char* pakPath;
+    const char* musicPath;
+} LaunchOptions;
+
+void ParseLaunchOptions(int argc, char** argv, LaunchOptions* options);
@@ -0,0 +1,97 @@
+#include "pak.h"
+#include "pak_format.h"
+#include "filemap.h"
+#include <stdio.h>
+#include <string.h>
+
+typedef struct Pak {
+    FileMapping mapping;
+    const PakHeader* header;
+    const PakEntry* entries;
+    const uint32_t* buckets;
+} Pak;
+
+static Pak pak;
+
+static bool RangeValid(uint32_t offset, uint64_t size, uint32_t fileSize) {
+    return offset <= fileSize && size <= fileSize - offset;
+}
+
+static bool ValidatePak(const void* data, size_t size) {
+    if (size < sizeof(PakHeader) || size > UINT32_MAX) return false;
+
+    const PakHeader* header = data;
+    if (header->magic != PAK_MAGIC || header->version != PAK_VERSION || header->fileSize != size) return false;
+    if (header->bucketCount == 0 || (header->bucketCount & (header->bucketCount - 1)) != 0) return false;
+    if (header->bucketCount < header->entryCount) return false;
+    if (!RangeValid(header->entriesOffset, (uint64_t)header->entryCount * sizeof(PakEntry), header->fileSize)) return false;
+    if (!RangeValid(header->bucketsOffset, (uint64_t)header->bucketCount * sizeof(uint32_t), header->fileSize)) return false;
+    if (header->entriesOffset % 4 != 0 || header->bucketsOffset % 4 != 0) return false;
+
+    // a file plus its terminating zero must fit, and so must every path's terminator
+    const unsigned char* bytes = data;
+    const PakEntry* entries = (const PakEntry*)(bytes + header->entriesOffset);
+    for (uint32_t i = 0; i < header->entryCount; i++) {
+        if (!RangeValid(entries[i].dataOffset, (uint64_t)entries[i].size + 1, header->fileSize)) return false;
+        if (entries[i].pathOffset >= header->fileSize) return false;
+        if (!memchr(bytes + entries[i].pathOffset, '\0', header->fileSize - entries[i].pathOffset)) return false;
+    }
+    return true;
+}
+
+bool MountPak(const char* path) {
+    UnmountPak();
+
+    FileMapping mapping;
+    if (!MapFile(&mapping, path)) return false;
+    if (!ValidatePak(mapping.data, mapping.size)) {
+        fprintf(stderr, "PAK: [%s] is not a valid version %d archive, using loose files\n", path, PAK_VERSION);
+        UnmapFile(&mapping);
+        return false;
+    }
+
+    const unsigned char* bytes = mapping.data;
+    pak.mapping = mapping;
+    pak.header = mapping.data;
+    pak.entries = (const PakEntry*)(bytes + pak.header->entriesOffset);
+    pak.buckets = (const uint32_t*)(bytes + pak.header->bucketsOffset);
+    printf("PAK: [%s] mounted, %u files, %.1f MB\n", path, pak.header->entryCount, mapping.size / (1024.0 * 1024.0));
+    return true;
+}
+
+void UnmountPak(void) {
+    if (!pak.header) return;
+    UnmapFile(&pak.mapping);
+    memset(&pak, 0, sizeof(pak));
+}
+
+bool IsPakMounted(void) {
+    return pak.header != NULL;
+}
+
+static bool PathsEqual(const char* stored, const char* path) {
+    for (; *stored && *path; stored++, path++) {
+        char c = *path == '\\' ? '/' : *path;
+        if (*stored != c) return false;
+    }
+    return *stored == *path;
+}
+
+const void* FindPakFile(const char* path, uint32_t* size) {
+    if (!pak.header) return NULL;
+
+    const unsigned char* bytes = pak.mapping.data;
+    uint32_t hash = PakHashPath(path);
+    uint32_t mask = pak.header->bucketCount - 1;
+    for (uint32_t probe = 0; probe <= mask; probe++) {
+        uint32_t index = pak.buckets[(hash + probe) & mask];
+        if (index == PAK_EMPTY_BUCKET || index >= pak.header->entryCount) return NULL;
+
+        const PakEntry* entry = &pak.entries[index];
+        if (entry->hash == hash && PathsEqual((const char*)bytes + entry->pathOffset, path)) {
+            if (size) *size = entry->size;
+            return bytes + entry->dataOffset;
+        }
+    }
+    return NULL;
+}
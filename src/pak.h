@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// The mounted asset archive (pak_format.h, built by tools/pak). It is mapped once and
+// files come back as pointers into the mapping, so loaders decode straight from the
+// page cache instead of opening and reading loose files. Everything else keeps using
+// the loose file when the archive is missing or lacks the path.
+
+// Maps the archive and checks its tables. Replaces any archive already mounted.
+bool MountPak(const char* path);
+void UnmountPak(void);
+bool IsPakMounted(void);
+
+// The file's bytes inside the mapping, followed by a zero byte. NULL when nothing is
+// mounted or the archive has no such path. size may be NULL.
+// Valid until UnmountPak.
+const void* FindPakFile(const char* path, uint32_t* size);
@@ -0,0 +1,50 @@
+#pragma once
+
+// On-disk layout of a .pak archive: every file under assets/ in one image, found by
+// path through a hash table. Shared by the game, which maps the archive and reads
+// files in place, and by tools/pak, which writes it, so it depends only on stdint.
+//
+// A file is a PakHeader, PakEntry[entryCount], uint32_t buckets[bucketCount], the
+// zero-terminated paths, then the file contents. Each file starts on a PAK_ALIGN
+// boundary and is followed by a zero byte not counted in its size, so text files
+// (shaders) can be handed out as C strings without a copy.
+
+#include <stdint.h>
+
+#define PAK_MAGIC 0x4B504352u       // "RCPK" little-endian
+#define PAK_VERSION 1
+#define PAK_ALIGN 16
+#define PAK_EMPTY_BUCKET 0xFFFFFFFFu
+#define PAK_DEFAULT_NAME "assets.pak"
+
+typedef struct PakHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t fileSize;
+    uint32_t entryCount;
+    uint32_t bucketCount;       // power of two, at least twice entryCount
+    uint32_t entriesOffset;     // bytes from the start of the file
+    uint32_t bucketsOffset;     // entry index per bucket or PAK_EMPTY_BUCKET, linear probing
+    uint32_t pathsOffset;
+} PakHeader;
+
+typedef struct PakEntry {
+    uint32_t hash;              // PakHashPath of the path
+    uint32_t pathOffset;        // from the start of the file, e.g. "assets/map/tileset.png"
+    uint32_t dataOffset;
+    uint32_t size;
+} PakEntry;
+
+// FNV-1a over the path with '\' read as '/', so both spellings find the same file
+inline static uint32_t PakHashPath(const char* path)
+{
+    uint32_t hash = 2166136261u;
+    for (const char* c = path; *c; c++) {
+        hash ^= (unsigned char)(*c == '\\' ? '/' : *c);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+_Static_assert(sizeof(PakHeader) == 32, "PakHeader must have no padding");
+_Static_assert(sizeof(PakEntry) == 16, "PakEntry must have no padding");
@@ -0,0 +1,140 @@
+#include "profiler.h"
+
+#if PROFILER_ENABLED
+
+#include "raylib.h"
+#include <stdlib.h>
+#include <string.h>
+
+static const char* zoneNames[PROFILE_ZONE_COUNT] = {
+    [PROFILE_INPUT] = "input",
+    [PROFILE_SIM] = "simulation",
+    [PROFILE_BRAIN] = "brain",
+    [PROFILE_POWERUPS] = "power-ups",
+    [PROFILE_COLLISION] = "collision",
+    [PROFILE_DASH] = "dash",
+    [PROFILE_MOBS] = "mobs",
+    [PROFILE_DOTS] = "dots",
+    [PROFILE_LASER] = "laser",
+    [PROFILE_CONTACTS] = "contacts",
+    [PROFILE_RESET] = "reset",
+    [PROFILE_CAMERA] = "camera",
+    [PROFILE_WORLD_DRAW] = "world draw",
+    [PROFILE_BLIT] = "letterbox blit",
+    [PROFILE_HUD] = "hud",
+    [PROFILE_PRESENT] = "EndDrawing",
+};
+
+static double zoneStart[PROFILE_ZONE_COUNT];
+static double frameTotal[PROFILE_ZONE_COUNT];               // seconds spent in each zone this frame
+static float history[PROFILE_ZONE_COUNT][PROFILER_HISTORY]; // milliseconds, ring buffer
+static int historyHead;
+static int historyCount;
+static double runTotal[PROFILE_ZONE_COUNT];
+static long long runFrames;
+
+static bool traceFrameOpen;
+
+// raylib's GetTime needs a window, the trace clock works headless too
+void ProfilerBegin(ProfileZone zone) {
+    zoneStart[zone] = GetTraceTime();
+    if (IsTraceCapturing()) TraceBegin(zoneNames[zone]);
+}
+
+void ProfilerEnd(ProfileZone zone) {
+    frameTotal[zone] += GetTraceTime() - zoneStart[zone];
+    if (IsTraceCapturing()) TraceEnd(zoneNames[zone]);
+}
+
+void ProfilerEndFrame(void) {
+    // frames show up in a capture as back to back "frame" spans
+    if (IsTraceCapturing()) {
+        if (traceFrameOpen) TraceEnd("frame");
+        TraceBegin("frame");
+        traceFrameOpen = true;
+    }
+
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        history[z][historyHead] = (float)(frameTotal[z] * 1000.0);
+        runTotal[z] += frameTotal[z];
+        frameTotal[z] = 0.0;
+    }
+    historyHead = (historyHead + 1) % PROFILER_HISTORY;
+    if (historyCount < PROFILER_HISTORY) historyCount++;
+    runFrames++;
+}
+
+double GetProfileTotal(ProfileZone zone) {
+    return runTotal[zone];
+}
+
+long long GetProfiledFrames(void) {
+    return runFrames;
+}
+
+const char* GetProfileZoneName(ProfileZone zone) {
+    return zoneNames[zone];
+}
+
+void ResetProfiler(void) {
+    memset(frameTotal, 0, sizeof(frameTotal));
+    memset(history, 0, sizeof(history));
+    memset(runTotal, 0, sizeof(runTotal));
+    historyHead = 0;
+    historyCount = 0;
+    runFrames = 0;
+}
+
+static int CompareFloats(const void* a, const void* b) {
+    float fa = *(const float*)a;
+    float fb = *(const float*)b;
+    return (fa > fb) - (fa < fb);
+}
+
+ProfileStats GetProfileStats(ProfileZone zone) {
+    ProfileStats stats = {0};
+    if (historyCount == 0) return stats;
+
+    float sorted[PROFILER_HISTORY];
+    memcpy(sorted, history[zone], sizeof(float) * historyCount);
+    qsort(sorted, historyCount, sizeof(float), CompareFloats);
+
+    double sum = 0.0;
+    for (int i = 0; i < historyCount; i++) sum += sorted[i];
+
+    int p99Index = (historyCount * 99 + 99) / 100 - 1;   // nearest-rank percentile
+    stats.min = sorted[0];
+    stats.avg = sum / historyCount;
+    stats.p99 = sorted[p99Index];
+    return stats;
+}
+
+void DrawProfilerOverlay(int x, int y) {
+    const int fontSize = 10;
+    const int lineHeight = 12;
+    const int width = 300;
+
+    DrawRectangle(x, y, width, lineHeight * (PROFILE_ZONE_COUNT + 2) + 8, Fade(BLACK, 0.75f));
+    x += 6;
+    y += 4;
+
+    DrawText(TextFormat("cpu ms over %d frames", historyCount), x, y, fontSize, YELLOW);
+    y += lineHeight;
+    DrawText("zone", x, y, fontSize, GRAY);
+    DrawText("min", x + 140, y, fontSize, GRAY);
+    DrawText("avg", x + 190, y, fontSize, GRAY);
+    DrawText("p99", x + 240, y, fontSize, GRAY);
+    y += lineHeight;
+
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        ProfileStats stats = GetProfileStats(z);
+        bool simPhase = z > PROFILE_SIM && z <= PROFILE_CAMERA;     // indented under "simulation"
+        DrawText(zoneNames[z], simPhase ? x + 10 : x, y, fontSize, WHITE);
+        DrawText(TextFormat("%.3f", stats.min), x + 140, y, fontSize, WHITE);
+        DrawText(TextFormat("%.3f", stats.avg), x + 190, y, fontSize, WHITE);
+        DrawText(TextFormat("%.3f", stats.p99), x + 240, y, fontSize, stats.p99 > 4.0 ? RED : WHITE);
+        y += lineHeight;
+    }
+}
+
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "trace.h"
+#include <stdbool.h>
+
+// Rolling CPU timings for each phase of the main loop. The PROFILE_* and TRACE_*
+// macros are the only instrumentation points and compile to nothing when NDEBUG is
+// defined, which the Release configurations in build/premake5.lua do (unless premake
+// runs with --profiler, which keeps them for playtest builds).
+// While a trace capture runs (trace.h) every zone is also recorded as a trace event.
+#if !defined(PROFILER_ENABLED)
+    #if defined(NDEBUG)
+        #define PROFILER_ENABLED 0
+    #else
+        #define PROFILER_ENABLED 1
+    #endif
+#endif
+
+#define PROFILER_HISTORY 240    // frames kept for min/avg/p99 (4 s at 60 fps)
+
+typedef enum ProfileZone {
+    PROFILE_INPUT = 0,
+    PROFILE_SIM,            // every game_step of the frame, includes the phases below
+    PROFILE_BRAIN,
+    PROFILE_POWERUPS,
+    PROFILE_COLLISION,
+    PROFILE_DASH,
+    PROFILE_MOBS,
+    PROFILE_DOTS,
+    PROFILE_LASER,
+    PROFILE_CONTACTS,       // the broadphase pass and every pair handler
+    PROFILE_RESET,
+    PROFILE_CAMERA,
+    PROFILE_WORLD_DRAW,     // everything rendered into the virtual target
+    PROFILE_BLIT,           // letterboxed copy of the target to the screen
+    PROFILE_HUD,
+    PROFILE_PRESENT,        // EndDrawing: batch flush, swap and any vsync wait
+    PROFILE_ZONE_COUNT
+} ProfileZone;
+
+typedef struct ProfileStats {
+    double min;     // milliseconds per frame
+    double avg;
+    double p99;
+} ProfileStats;
+
+#if PROFILER_ENABLED
+
+// A zone can be entered several times per frame (one per simulation step), the times add up
+void ProfilerBegin(ProfileZone zone);
+void ProfilerEnd(ProfileZone zone);
+
+// Pushes this frame's totals into the history and starts the next frame
+void ProfilerEndFrame(void);
+
+ProfileStats GetProfileStats(ProfileZone zone);
+
+// Whole-run totals for benchmarks, unaffected by the history window
+double GetProfileTotal(ProfileZone zone);   // seconds since the last ResetProfiler
+long long GetProfiledFrames(void);
+const char* GetProfileZoneName(ProfileZone zone);
+
+// Clears the history and the run totals
+void ResetProfiler(void);
+
+// Table of every zone's stats in screen space, call between BeginDrawing and EndDrawing
+void DrawProfilerOverlay(int x, int y);
+
+#define PROFILE_BEGIN(zone) ProfilerBegin(zone)
+#define PROFILE_END(zone) ProfilerEnd(zone)
+#define PROFILE_FRAME_END() ProfilerEndFrame()
+
+// Trace-only scopes (asset loads and other one-off work), name must be static
+#define TRACE_BEGIN(name) TraceBegin(name)
+#define TRACE_END(name) TraceEnd(name)
+
+#else
+
+#define PROFILE_BEGIN(zone) ((void)0)
+#define PROFILE_END(zone) ((void)0)
+#define PROFILE_FRAME_END() ((void)0)
+#define TRACE_BEGIN(name) ((void)0)
+#define TRACE_END(name) ((void)0)
+
+#endif
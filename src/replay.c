@@ -0,0 +1,107 @@
+#include "replay.h"
+#include <string.h>
+
+_Static_assert(sizeof(ReplayHeader) == 16, "ReplayHeader must have no padding");
+_Static_assert(sizeof(ReplayRun) == 16, "ReplayRun must have no padding");
+_Static_assert(INPUT_ACTION_COUNT <= 16, "InputFrame bits must fit in 16 bits");
+
+static ReplayRun RunFromInput(const InputFrame* input) {
+    ReplayRun run = {
+        .repeat = 1,
+        .down = (uint16_t)input->down,
+        .pressed = (uint16_t)input->pressed,
+        .startLevel = (uint16_t)input->startLevel,
+        .mouseX = input->mouseVirtual.x,
+        .mouseY = input->mouseVirtual.y,
+    };
+    return run;
+}
+
+static bool SameInput(const ReplayRun* a, const ReplayRun* b) {
+    // memcmp on the floats: a replay must reproduce the recorded bits, not nearby values
+    return a->down == b->down && a->pressed == b->pressed && a->startLevel == b->startLevel &&
+        memcmp(&a->mouseX, &b->mouseX, sizeof(float)) == 0 &&
+        memcmp(&a->mouseY, &b->mouseY, sizeof(float)) == 0;
+}
+
+bool BeginReplayRecording(Replay* replay, const char* path, uint32_t seed) {
+    memset(replay, 0, sizeof(*replay));
+    replay->file = fopen(path, "wb");
+    if (!replay->file) {
+        TraceLog(LOG_WARNING, "REPLAY: [%s] could not be opened for recording", path);
+        return false;
+    }
+
+    replay->recording = true;
+    replay->header = (ReplayHeader){ REPLAY_MAGIC, REPLAY_VERSION, seed, 0 };
+    fwrite(&replay->header, sizeof(replay->header), 1, replay->file);
+    TraceLog(LOG_INFO, "REPLAY: [%s] recording with seed %u", path, seed);
+    return true;
+}
+
+void RecordReplayStep(Replay* replay, const InputFrame* input) {
+    if (!replay->file || !replay->recording) return;
+
+    ReplayRun run = RunFromInput(input);
+    if (replay->run.repeat > 0 && replay->run.repeat < UINT16_MAX && SameInput(&replay->run, &run)) {
+        replay->run.repeat++;
+    }
+    else {
+        if (replay->run.repeat > 0) fwrite(&replay->run, sizeof(replay->run), 1, replay->file);
+        replay->run = run;
+    }
+    replay->steps++;
+}
+
+bool BeginReplayPlayback(Replay* replay, const char* path) {
+    memset(replay, 0, sizeof(*replay));
+    replay->file = fopen(path, "rb");
+    if (!replay->file) {
+        TraceLog(LOG_WARNING, "REPLAY: [%s] could not be opened", path);
+        return false;
+    }
+
+    if (fread(&replay->header, sizeof(replay->header), 1, replay->file) != 1 ||
+        replay->header.magic != REPLAY_MAGIC || replay->header.version != REPLAY_VERSION) {
+        TraceLog(LOG_WARNING, "REPLAY: [%s] is not a version %d replay", path, REPLAY_VERSION);
+        fclose(replay->file);
+        replay->file = NULL;
+        return false;
+    }
+
+    TraceLog(LOG_INFO, "REPLAY: [%s] playing %u steps, seed %u", path, replay->header.stepCount, replay->header.seed);
+    return true;
+}
+
+bool ReadReplayStep(Replay* replay, InputFrame* input) {
+    if (!replay->file || replay->recording) return false;
+
+    if (replay->runLeft == 0) {
+        if (fread(&replay->run, sizeof(replay->run), 1, replay->file) != 1 || replay->run.repeat == 0) {
+            return false;
+        }
+        replay->runLeft = replay->run.repeat;
+    }
+
+    input->down = replay->run.down;
+    input->pressed = replay->run.pressed;
+    input->startLevel = replay->run.startLevel;
+    input->mouseVirtual = (Vector2){ replay->run.mouseX, replay->run.mouseY };
+    replay->runLeft--;
+    replay->steps++;
+    return true;
+}
+
+void EndReplay(Replay* replay) {
+    if (!replay->file) return;
+
+    if (replay->recording) {
+        if (replay->run.repeat > 0) fwrite(&replay->run, sizeof(replay->run), 1, replay->file);
+        replay->header.stepCount = replay->steps;
+        fseek(replay->file, 0, SEEK_SET);
+        fwrite(&replay->header, sizeof(replay->header), 1, replay->file);
+        TraceLog(LOG_INFO, "REPLAY: recorded %u steps", replay->steps);
+    }
+    fclose(replay->file);
+    replay->file = NULL;
+}
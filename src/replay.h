@@ -0,0 +1,49 @@
+#pragma once
+
+#include "input.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define REPLAY_MAGIC 0x50524352u    // "RCRP" little-endian
+#define REPLAY_VERSION 1
+
+// File layout: ReplayHeader, then ReplayRun records until EOF.
+// Each run is one InputFrame repeated for `repeat` simulation steps, so held keys
+// and a still mouse cost 16 bytes no matter how long they last.
+typedef struct ReplayHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t seed;          // Game RNG seed the recording was made with
+    uint32_t stepCount;     // total steps, patched in when recording ends
+} ReplayHeader;
+
+typedef struct ReplayRun {
+    uint16_t repeat;
+    uint16_t down;          // InputFrame.down
+    uint16_t pressed;       // InputFrame.pressed
+    uint16_t startLevel;    // InputFrame.startLevel
+    float mouseX;           // InputFrame.mouseVirtual, stored bit-exact
+    float mouseY;
+} ReplayRun;
+
+typedef struct Replay {
+    FILE* file;
+    bool recording;
+    ReplayHeader header;
+    ReplayRun run;          // recording: pending run, playback: current run
+    uint32_t runLeft;       // playback: steps left in the current run
+    uint32_t steps;         // steps recorded or played back so far
+} Replay;
+
+// Recording: call RecordReplayStep with the exact InputFrame handed to game_step
+bool BeginReplayRecording(Replay* replay, const char* path, uint32_t seed);
+void RecordReplayStep(Replay* replay, const InputFrame* input);
+
+// Playback: seed the Game with replay->header.seed, then read one frame per step.
+// Returns false once the recording is exhausted.
+bool BeginReplayPlayback(Replay* replay, const char* path);
+bool ReadReplayStep(Replay* replay, InputFrame* input);
+
+// Flushes and closes either mode
+void EndReplay(Replay* replay);
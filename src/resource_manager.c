@@ -0,0 +1,235 @@
+#include "resource_manager.h"
+#include <string.h>
+
+typedef struct Resource {
+    const char* path;       // NULL for a free slot
+    ResourceType type;
+    Texture2D texture;
+    Sound sound;
+    size_t bytes;
+    int refCount;
+    unsigned int generation;
+    unsigned int releaseOrder;  // when the last reference went, lowest is evicted first
+} Resource;
+
+typedef struct TextureOwner {
+    const char* owner;      // NULL for a free entry
+    int count;
+    size_t bytes;
+} TextureOwner;
+
+static struct {
+    Resource slots[MAX_RESOURCES];
+    TextureOwner owners[MAX_TEXTURE_OWNERS];
+    size_t textureBytes;    // adopted textures only, what the budget applies to
+    size_t trackedBytes;
+    unsigned int releaseCounter;
+    unsigned int generationCounter;
+} resources;
+
+static double ToMB(size_t bytes) {
+    return bytes / (1024.0 * 1024.0);
+}
+
+static Resource* GetResource(ResourceHandle handle) {
+    if (handle.generation == 0 || handle.slot < 0 || handle.slot >= MAX_RESOURCES) return NULL;
+    Resource* resource = &resources.slots[handle.slot];
+    return resource->path && resource->generation == handle.generation ? resource : NULL;
+}
+
+static void FreeResource(Resource* resource) {
+    if (resource->type == RESOURCE_TEXTURE) {
+        UnloadTexture(resource->texture);
+        resources.textureBytes -= resource->bytes;
+    }
+    else UnloadSound(resource->sound);
+    memset(resource, 0, sizeof(*resource));
+}
+
+// Unloads unreferenced textures, least recently released first, until under budget
+static void EvictToBudget(void) {
+    while (resources.textureBytes > RESOURCE_VRAM_BUDGET) {
+        Resource* oldest = NULL;
+        for (int i = 0; i < MAX_RESOURCES; i++) {
+            Resource* resource = &resources.slots[i];
+            if (!resource->path || resource->type != RESOURCE_TEXTURE || resource->refCount > 0) continue;
+            if (!oldest || resource->releaseOrder < oldest->releaseOrder) oldest = resource;
+        }
+        if (!oldest) {
+            TraceLog(LOG_WARNING, "RESOURCES: %.1f MB of textures in use, over the %.1f MB budget",
+                ToMB(resources.textureBytes), ToMB(RESOURCE_VRAM_BUDGET));
+            return;
+        }
+        TraceLog(LOG_INFO, "RESOURCES: [%s] evicted, %.1f MB", oldest->path, ToMB(oldest->bytes));
+        FreeResource(oldest);
+    }
+}
+
+static ResourceHandle AddResource(const Resource* resource) {
+    for (int i = 0; i < MAX_RESOURCES; i++) {
+        Resource* slot = &resources.slots[i];
+        if (slot->path) continue;
+
+        *slot = *resource;
+        slot->refCount = 1;
+        slot->generation = ++resources.generationCounter;
+        if (slot->type == RESOURCE_TEXTURE) {
+            resources.textureBytes += slot->bytes;
+            EvictToBudget();
+        }
+        return (ResourceHandle){ i, slot->generation };
+    }
+    TraceLog(LOG_WARNING, "RESOURCES: [%s] not tracked, more than %d resources", resource->path, MAX_RESOURCES);
+    return (ResourceHandle){0};
+}
+
+ResourceHandle AdoptTexture(const char* path, Texture2D texture) {
+    if (texture.id == 0) return (ResourceHandle){0};
+
+    // the same file twice shares the first upload
+    ResourceHandle handle;
+    if (AcquireTexture(path, &handle)) {
+        UnloadTexture(texture);
+        return handle;
+    }
+
+    return AddResource(&(Resource){
+        .path = path,
+        .type = RESOURCE_TEXTURE,
+        .texture = texture,
+        .bytes = (size_t)GetPixelDataSize(texture.width, texture.height, texture.format),
+    });
+}
+
+ResourceHandle AdoptSound(const char* path, Sound sound) {
+    if (sound.frameCount == 0) return (ResourceHandle){0};
+
+    return AddResource(&(Resource){
+        .path = path,
+        .type = RESOURCE_SOUND,
+        .sound = sound,
+        .bytes = (size_t)sound.frameCount * sound.stream.channels * (sound.stream.sampleSize / 8),
+    });
+}
+
+bool AcquireTexture(const char* path, ResourceHandle* handle) {
+    for (int i = 0; i < MAX_RESOURCES; i++) {
+        Resource* resource = &resources.slots[i];
+        if (!resource->path || resource->type != RESOURCE_TEXTURE || strcmp(resource->path, path) != 0) continue;
+
+        resource->refCount++;
+        *handle = (ResourceHandle){ i, resource->generation };
+        return true;
+    }
+    return false;
+}
+
+bool IsResourceValid(ResourceHandle handle) {
+    return GetResource(handle) != NULL;
+}
+
+Texture2D GetTexture(ResourceHandle handle) {
+    Resource* resource = GetResource(handle);
+    return resource && resource->type == RESOURCE_TEXTURE ? resource->texture : (Texture2D){0};
+}
+
+void ReleaseResource(ResourceHandle handle) {
+    Resource* resource = GetResource(handle);
+    if (!resource || resource->refCount == 0) return;
+    if (--resource->refCount > 0) return;
+
+    if (resource->type == RESOURCE_SOUND) {
+        FreeResource(resource);
+        return;
+    }
+    resource->releaseOrder = ++resources.releaseCounter;
+    EvictToBudget();
+}
+
+static TextureOwner* FindOwner(const char* owner) {
+    TextureOwner* unused = NULL;
+    for (int i = 0; i < MAX_TEXTURE_OWNERS; i++) {
+        TextureOwner* entry = &resources.owners[i];
+        if (entry->owner && strcmp(entry->owner, owner) == 0) return entry;
+        if (!entry->owner && !unused) unused = entry;
+    }
+    if (unused) unused->owner = owner;
+    else TraceLog(LOG_WARNING, "RESOURCES: [%s] not tracked, more than %d texture owners", owner, MAX_TEXTURE_OWNERS);
+    return unused;
+}
+
+static void Track(const char* owner, int count, size_t bytes) {
+    TextureOwner* entry = FindOwner(owner);
+    if (!entry) return;
+    entry->count += count;
+    entry->bytes += bytes;
+    resources.trackedBytes += bytes;
+}
+
+static void Untrack(const char* owner, int count, size_t bytes) {
+    TextureOwner* entry = FindOwner(owner);
+    if (!entry || entry->count < count || entry->bytes < bytes) return;
+    entry->count -= count;
+    entry->bytes -= bytes;
+    resources.trackedBytes -= bytes;
+}
+
+static size_t RenderTextureBytes(RenderTexture2D target) {
+    size_t depth = (size_t)target.depth.width * target.depth.height * 4;    // 24-bit depth, stored in 32
+    return (size_t)GetPixelDataSize(target.texture.width, target.texture.height, target.texture.format) + depth;
+}
+
+void TrackTexture(const char* owner, Texture2D texture) {
+    if (texture.id != 0) Track(owner, 1, (size_t)GetPixelDataSize(texture.width, texture.height, texture.format));
+}
+
+void UntrackTexture(const char* owner, Texture2D texture) {
+    if (texture.id != 0) Untrack(owner, 1, (size_t)GetPixelDataSize(texture.width, texture.height, texture.format));
+}
+
+void TrackRenderTexture(const char* owner, RenderTexture2D target) {
+    if (target.id != 0) Track(owner, 1, RenderTextureBytes(target));
+}
+
+void UntrackRenderTexture(const char* owner, RenderTexture2D target) {
+    if (target.id != 0) Untrack(owner, 1, RenderTextureBytes(target));
+}
+
+size_t GetResidentTextureBytes(void) {
+    return resources.textureBytes + resources.trackedBytes;
+}
+
+void ShutdownResources(void) {
+    size_t cached = 0;
+    for (int i = 0; i < MAX_RESOURCES; i++) {
+        Resource* resource = &resources.slots[i];
+        if (!resource->path || resource->refCount > 0) continue;
+        cached += resource->bytes;
+        FreeResource(resource);
+    }
+
+    int leaks = 0;
+    size_t leaked = 0;
+    for (int i = 0; i < MAX_RESOURCES; i++) {
+        Resource* resource = &resources.slots[i];
+        if (!resource->path) continue;
+        TraceLog(LOG_WARNING, "RESOURCES: leaked %s [%s], %d refs, %.2f MB",
+            resource->type == RESOURCE_TEXTURE ? "texture" : "sound", resource->path, resource->refCount, ToMB(resource->bytes));
+        leaks++;
+        leaked += resource->bytes;
+        FreeResource(resource);
+    }
+
+    // not ours to unload, only to name
+    for (int i = 0; i < MAX_TEXTURE_OWNERS; i++) {
+        TextureOwner* entry = &resources.owners[i];
+        if (!entry->owner || entry->count == 0) continue;
+        TraceLog(LOG_WARNING, "RESOURCES: leaked %d generated textures [%s], %.2f MB", entry->count, entry->owner, ToMB(entry->bytes));
+        leaks += entry->count;
+        leaked += entry->bytes;
+    }
+
+    if (leaks > 0) TraceLog(LOG_WARNING, "RESOURCES: %d resources leaked, %.2f MB", leaks, ToMB(leaked));
+    else TraceLog(LOG_INFO, "RESOURCES: shut down clean, %.1f MB of cached textures released", ToMB(cached));
+    memset(&resources, 0, sizeof(resources));
+}
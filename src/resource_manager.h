@@ -0,0 +1,62 @@
+#pragma once
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// Every texture and sound loaded from a file, by path, with a reference count. Loads
+// still go through an AssetLoader; the finished result is handed over with Adopt*.
+// A texture whose last reference is released stays resident, so going back to a scene
+// costs nothing, until the textures held pass RESOURCE_VRAM_BUDGET: then the least
+// recently released ones are unloaded. Sounds are freed with their last reference.
+// Textures generated at runtime stay with the module that made it, which only reports
+// them here. ShutdownResources lists whatever is still referenced or reported at exit.
+
+#define MAX_RESOURCES 64
+#define MAX_TEXTURE_OWNERS 16       // modules reporting generated textures
+#define RESOURCE_VRAM_BUDGET (32 * 1024 * 1024)    // bytes of texture pixels, referenced or cached
+
+typedef enum ResourceType {
+    RESOURCE_TEXTURE = 0,
+    RESOURCE_SOUND
+} ResourceType;
+
+// Names a slot and the load that filled it, so a handle kept past its release never
+// finds a newer resource in the same slot. A zeroed handle is never valid.
+typedef struct ResourceHandle {
+    int slot;
+    unsigned int generation;
+} ResourceHandle;
+
+// Takes ownership with one reference. path is stored by pointer and must outlive the
+// resource. On an invalid handle (table full, failed load) the caller keeps ownership.
+ResourceHandle AdoptTexture(const char* path, Texture2D texture);
+ResourceHandle AdoptSound(const char* path, Sound sound);
+
+// Adds a reference to a texture that is still resident, referenced or cached
+bool AcquireTexture(const char* path, ResourceHandle* handle);
+
+bool IsResourceValid(ResourceHandle handle);
+
+// id 0 for an invalid handle
+Texture2D GetTexture(ResourceHandle handle);
+
+// Drops one reference. Harmless on an invalid handle.
+void ReleaseResource(ResourceHandle handle);
+
+// The sprite atlas, render targets, tile index maps: textures not loaded from a file.
+// The caller keeps ownership and untracks before unloading. owner names the kind of
+// texture, is stored by pointer and must outlive the resource manager.
+void TrackTexture(const char* owner, Texture2D texture);
+void UntrackTexture(const char* owner, Texture2D texture);
+
+// Counts the colour texture and the depth buffer raylib attaches to it
+void TrackRenderTexture(const char* owner, RenderTexture2D target);
+void UntrackRenderTexture(const char* owner, RenderTexture2D target);
+
+// Pixel bytes of every resident texture, referenced, cached or tracked
+size_t GetResidentTextureBytes(void);
+
+// Unloads the cached textures, then reports and unloads every resource still referenced,
+// and reports the tracked textures never untracked
+void ShutdownResources(void);
@@ -0,0 +1,70 @@
+#include "resource_set.h"
+#include <string.h>
+
+void InitResourceSet(ResourceSet* set, const char* name) {
+    memset(set, 0, sizeof(*set));
+    set->name = name;
+}
+
+int AddSetTexture(ResourceSet* set, const char* path) {
+    if (set->count == MAX_SET_TEXTURES) {
+        TraceLog(LOG_WARNING, "SCENE: [%s] is full, %s not added", set->name, path);
+        return MAX_SET_TEXTURES - 1;
+    }
+    set->paths[set->count] = path;
+    return set->count++;
+}
+
+void PrefetchResourceSet(ResourceSet* set) {
+    if (set->state != RESOURCE_SET_UNLOADED) return;
+    if (!InitAssetLoader(&set->loader)) return;
+
+    for (int i = 0; i < set->count; i++) {
+        if (AcquireTexture(set->paths[i], &set->handles[i])) set->textures[i] = GetTexture(set->handles[i]);
+        else QueueTextureLoad(&set->loader, &set->textures[i], set->paths[i]);
+    }
+    StartAssetLoads(&set->loader);
+    set->state = RESOURCE_SET_LOADING;
+}
+
+bool UpdateResourceSet(ResourceSet* set, double budgetSeconds) {
+    if (set->state == RESOURCE_SET_UNLOADED) PrefetchResourceSet(set);
+    if (set->state != RESOURCE_SET_LOADING) return set->state == RESOURCE_SET_READY;
+
+    if (!UpdateAssetLoader(&set->loader, budgetSeconds)) return false;
+
+    LogAssetLoadTimes(&set->loader);
+    UnloadAssetLoader(&set->loader);
+    for (int i = 0; i < set->count; i++) {
+        if (IsResourceValid(set->handles[i])) continue;
+        // a texture already resident under the same path wins, ours was unloaded
+        set->handles[i] = AdoptTexture(set->paths[i], set->textures[i]);
+        if (IsResourceValid(set->handles[i])) set->textures[i] = GetTexture(set->handles[i]);
+    }
+    set->state = RESOURCE_SET_READY;
+    TraceLog(LOG_INFO, "SCENE: [%s] loaded", set->name);
+    return true;
+}
+
+float GetResourceSetProgress(const ResourceSet* set) {
+    if (set->state == RESOURCE_SET_READY) return 1.0f;
+    if (set->state == RESOURCE_SET_LOADING) return GetAssetLoadProgress(&set->loader);
+    return 0.0f;
+}
+
+void UnloadResourceSet(ResourceSet* set) {
+    if (set->state == RESOURCE_SET_UNLOADED) return;
+
+    // finish a prefetch first, textures it already uploaded but never handed over
+    // to the manager are still ours to unload
+    if (set->state == RESOURCE_SET_LOADING) UnloadAssetLoader(&set->loader);
+
+    for (int i = 0; i < set->count; i++) {
+        if (IsResourceValid(set->handles[i])) ReleaseResource(set->handles[i]);
+        else if (set->textures[i].id != 0) UnloadTexture(set->textures[i]);
+        set->textures[i] = (Texture2D){0};
+        set->handles[i] = (ResourceHandle){0};
+    }
+    set->state = RESOURCE_SET_UNLOADED;
+    TraceLog(LOG_INFO, "SCENE: [%s] released, %.1f MB of textures resident", set->name, GetResidentTextureBytes() / (1024.0 * 1024.0));
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "raylib.h"
+#include "asset_loader.h"
+#include "resource_manager.h"
+#include <stdbool.h>
+
+#define MAX_SET_TEXTURES 8
+
+typedef enum ResourceSetState {
+    RESOURCE_SET_UNLOADED = 0,
+    RESOURCE_SET_LOADING,   // decodes queued on the job workers, uploads pending
+    RESOURCE_SET_READY
+} ResourceSetState;
+
+// Textures that belong to one scene. They are acquired when the scene is entered, or
+// prefetched ahead of it, and released when it is left. Textures the resource manager
+// still holds are reused; the rest load through an AssetLoader and are handed over
+// to the manager once uploaded.
+typedef struct ResourceSet {
+    const char* name;
+    const char* paths[MAX_SET_TEXTURES];
+    Texture2D textures[MAX_SET_TEXTURES];  // valid once READY, id 0 for files that failed
+    ResourceHandle handles[MAX_SET_TEXTURES];
+    int count;
+    ResourceSetState state;
+    AssetLoader loader;                     // in use while LOADING
+} ResourceSet;
+
+void InitResourceSet(ResourceSet* set, const char* name);
+
+// Returns the slot the texture will occupy in set->textures
+int AddSetTexture(ResourceSet* set, const char* path);
+
+// Starts decoding on the job workers and returns. Does nothing unless the set is UNLOADED.
+void PrefetchResourceSet(ResourceSet* set);
+
+// Main thread: prefetches if needed, then uploads within budgetSeconds. True once READY.
+bool UpdateResourceSet(ResourceSet* set, double budgetSeconds);
+
+float GetResourceSetProgress(const ResourceSet* set);
+
+// Releases the textures, waiting for a prefetch still in flight
+void UnloadResourceSet(ResourceSet* set);
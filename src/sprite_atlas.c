@@ -0,0 +1,93 @@
+#include "sprite_atlas.h"
+#include "asset_loader.h"
+#include "profiler.h"
+#include "resource_manager.h"
+#include <string.h>
+
+static const char* spritePaths[SPRITE_COUNT] = {
+    [SPRITE_DAMAGE_BLOCK] = "assets/map/damage_block.png",
+    [SPRITE_TELEPORTER] = "assets/map/teleporter.png",
+    [SPRITE_WIZARD] = "assets/npc/wizard.png",
+    [SPRITE_LASER] = "assets/hero/laser.png",
+    [SPRITE_BRAIN] = "assets/boss/brain.png",
+    [SPRITE_DOUBLE_JUMP] = "assets/powerups/djump.png",
+    [SPRITE_DASH] = "assets/powerups/dash.png",
+    [SPRITE_LEVITATION] = "assets/powerups/levitation.png",
+    [SPRITE_PHASE] = "assets/powerups/phase.png",
+    [SPRITE_EYEBALL] = "assets/enemies/eyeball.png",
+};
+
+const char* GetSpritePath(SpriteId sprite) {
+    return spritePaths[sprite];
+}
+
+bool LoadSpriteAtlas(SpriteAtlas* atlas) {
+    Image images[SPRITE_COUNT];
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        TRACE_BEGIN(spritePaths[i]);
+        images[i] = LoadImageAsset(spritePaths[i]);
+        TRACE_END(spritePaths[i]);
+    }
+    return BuildSpriteAtlas(atlas, images);
+}
+
+bool BuildSpriteAtlas(SpriteAtlas* atlas, Image images[SPRITE_COUNT]) {
+    memset(atlas, 0, sizeof(*atlas));
+
+    int order[SPRITE_COUNT];
+    int count = 0;
+    for (int i = 0; i < SPRITE_COUNT; i++) {
+        if (!IsImageValid(images[i]) || images[i].width > SPRITE_ATLAS_WIDTH) {
+            TraceLog(LOG_WARNING, "ATLAS: [%s] skipped", spritePaths[i]);
+            continue;
+        }
+
+        // tallest first keeps the shelves tight
+        int at = count++;
+        while (at > 0 && images[order[at - 1]].height < images[i].height) {
+            order[at] = order[at - 1];
+            at--;
+        }
+        order[at] = i;
+    }
+
+    // shelf packing: fill a row left to right, start a new one below the tallest sprite when full
+    int x = 0, y = 0, shelfHeight = 0;
+    for (int n = 0; n < count; n++) {
+        Image* image = &images[order[n]];
+        if (x + image->width > SPRITE_ATLAS_WIDTH) {
+            x = 0;
+            y += shelfHeight + SPRITE_ATLAS_PADDING;
+            shelfHeight = 0;
+        }
+        atlas->rects[order[n]] = (Rectangle){ x, y, image->width, image->height };
+        x += image->width + SPRITE_ATLAS_PADDING;
+        if (image->height > shelfHeight) shelfHeight = image->height;
+    }
+
+    int height = 1;
+    while (height < y + shelfHeight) height *= 2;
+
+    TRACE_BEGIN("pack sprite atlas");
+    Image packed = GenImageColor(SPRITE_ATLAS_WIDTH, height, BLANK);
+    for (int n = 0; n < count; n++) {
+        Image* image = &images[order[n]];
+        Rectangle rect = atlas->rects[order[n]];
+        ImageDraw(&packed, *image, (Rectangle){0, 0, image->width, image->height}, rect, WHITE);
+    }
+    for (int i = 0; i < SPRITE_COUNT; i++) UnloadImage(images[i]);
+
+    atlas->texture = LoadTextureFromImage(packed);
+    TrackTexture("sprite atlas", atlas->texture);
+    UnloadImage(packed);
+    TRACE_END("pack sprite atlas");
+
+    TraceLog(LOG_INFO, "ATLAS: packed %d of %d sprites into %dx%d", count, SPRITE_COUNT, SPRITE_ATLAS_WIDTH, height);
+    return atlas->texture.id != 0;
+}
+
+void UnloadSpriteAtlas(SpriteAtlas* atlas) {
+    UntrackTexture("sprite atlas", atlas->texture);
+    UnloadTexture(atlas->texture);
+    memset(atlas, 0, sizeof(*atlas));
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "raylib.h"
+
+#define SPRITE_ATLAS_WIDTH 1024     // atlas grows downwards in power-of-two steps
+#define SPRITE_ATLAS_PADDING 2      // transparent gap between sprites so neighbours never bleed in
+
+// Small world sprites, packed together so their draws share one texture and one batch
+typedef enum SpriteId {
+    SPRITE_DAMAGE_BLOCK = 0,
+    SPRITE_TELEPORTER,
+    SPRITE_WIZARD,
+    SPRITE_LASER,
+    SPRITE_BRAIN,
+    SPRITE_DOUBLE_JUMP,
+    SPRITE_DASH,
+    SPRITE_LEVITATION,
+    SPRITE_PHASE,
+    SPRITE_EYEBALL,
+    SPRITE_COUNT
+} SpriteId;
+
+typedef struct SpriteAtlas {
+    Texture2D texture;
+    Rectangle rects[SPRITE_COUNT];  // source rect of each sprite inside texture, zero if it failed to load
+} SpriteAtlas;
+
+// Loads every sprite PNG and shelf-packs them into one texture. Must be called after InitWindow.
+bool LoadSpriteAtlas(SpriteAtlas* atlas);
+
+// Packing step on its own, for images decoded elsewhere (asset_loader.h).
+// images[i] holds GetSpritePath(i) or has NULL data if it failed; all of them are unloaded.
+bool BuildSpriteAtlas(SpriteAtlas* atlas, Image images[SPRITE_COUNT]);
+
+const char* GetSpritePath(SpriteId sprite);
+void UnloadSpriteAtlas(SpriteAtlas* atlas);
+
+// Same as DrawTexturePro with the whole sprite as the source rect
+inline static void DrawSprite(const SpriteAtlas* atlas, SpriteId sprite, Rectangle dest, Color tint)
+{
+    DrawTexturePro(atlas->texture, atlas->rects[sprite], dest, (Vector2){0, 0}, 0.0f, tint);
+}
@@ -0,0 +1,66 @@
+#include "sprite_sheet.h"
+#include "asset_loader.h"
+#include "profiler.h"
+#include <string.h>
+
+// Smallest rect holding every pixel with alpha > 0, zero size when there is none
+static Rectangle OpaqueBounds(const Color* pixels, int stride, int x0, int y0, int width, int height) {
+    int minX = width, minY = height, maxX = -1, maxY = -1;
+    for (int y = 0; y < height; y++) {
+        const Color* row = pixels + (y0 + y) * stride + x0;
+        for (int x = 0; x < width; x++) {
+            if (row[x].a == 0) continue;
+            if (x < minX) minX = x;
+            if (x > maxX) maxX = x;
+            if (y < minY) minY = y;
+            maxY = y;
+        }
+    }
+    if (maxX < 0) return (Rectangle){0};
+    return (Rectangle){ x0 + minX, y0 + minY, maxX - minX + 1, maxY - minY + 1 };
+}
+
+bool BuildSpriteSheet(SpriteSheet* sheet, Image image, int columns, int rows) {
+    memset(sheet, 0, sizeof(*sheet));
+    if (!IsImageValid(image) || columns <= 0 || rows <= 0 || columns * rows > MAX_SHEET_FRAMES ||
+        image.width % columns != 0 || image.height % rows != 0) {
+        TraceLog(LOG_WARNING, "SHEET: %dx%d image can't be cut into %dx%d cells", image.width, image.height, columns, rows);
+        UnloadImage(image);
+        return false;
+    }
+
+    TRACE_BEGIN("trim sprite sheet");
+    ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    int cellWidth = image.width / columns;
+    int cellHeight = image.height / rows;
+    long long trimmedArea = 0;
+    for (int row = 0; row < rows; row++) {
+        for (int column = 0; column < columns; column++) {
+            int x0 = column * cellWidth, y0 = row * cellHeight;
+            Rectangle bounds = OpaqueBounds(image.data, image.width, x0, y0, cellWidth, cellHeight);
+            sheet->frames[row * columns + column] = (SheetFrame){ bounds, { bounds.x - x0, bounds.y - y0 } };
+            trimmedArea += (long long)(bounds.width * bounds.height);
+        }
+    }
+    TRACE_END("trim sprite sheet");
+
+    sheet->columns = columns;
+    sheet->rows = rows;
+    sheet->cellWidth = (float)cellWidth;
+    sheet->cellHeight = (float)cellHeight;
+    sheet->texture = LoadTextureFromImage(image);
+    UnloadImage(image);
+
+    TraceLog(LOG_INFO, "SHEET: %dx%d cells trimmed to %.1f%% of their area", columns, rows,
+        100.0 * trimmedArea / ((double)cellWidth * cellHeight * columns * rows));
+    return sheet->texture.id != 0;
+}
+
+bool LoadSpriteSheet(SpriteSheet* sheet, const char* path, int columns, int rows) {
+    return BuildSpriteSheet(sheet, LoadImageAsset(path), columns, rows);
+}
+
+void UnloadSpriteSheet(SpriteSheet* sheet) {
+    UnloadTexture(sheet->texture);
+    memset(sheet, 0, sizeof(*sheet));
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define MAX_SHEET_FRAMES 128    // columns * rows, the hero's 14x8 grid is the largest
+
+// A grid of equally sized animation cells, each trimmed to its opaque pixels when the
+// sheet is built. Drawing only the trimmed rect, placed at its offset inside the cell,
+// puts the same pixels on screen while skipping the transparent padding the blender
+// would otherwise have to chew through.
+typedef struct SheetFrame {
+    Rectangle source;   // opaque bounds inside the texture, zero size for an empty cell
+    Vector2 offset;     // of source's top-left from the cell's top-left, in texels
+} SheetFrame;
+
+typedef struct SpriteSheet {
+    Texture2D texture;
+    int columns;
+    int rows;
+    float cellWidth;
+    float cellHeight;
+    SheetFrame frames[MAX_SHEET_FRAMES];    // row-major
+} SpriteSheet;
+
+// Trims every cell and uploads the image, which is unloaded either way. Must be called
+// after InitWindow. False, with an empty sheet, if the image or the grid is unusable.
+bool BuildSpriteSheet(SpriteSheet* sheet, Image image, int columns, int rows);
+bool LoadSpriteSheet(SpriteSheet* sheet, const char* path, int columns, int rows);
+void UnloadSpriteSheet(SpriteSheet* sheet);
+
+// Same result as DrawTexturePro with the whole cell scaled into dest (positive size),
+// mirrored horizontally when flipX is set
+inline static void DrawSheetFrame(const SpriteSheet* sheet, SheetFrame frame, Rectangle dest, bool flipX, Color tint)
+{
+    if (frame.source.width <= 0.0f) return;
+
+    float scaleX = dest.width / sheet->cellWidth;
+    float scaleY = dest.height / sheet->cellHeight;
+    float offsetX = flipX ? sheet->cellWidth - frame.offset.x - frame.source.width : frame.offset.x;
+
+    Rectangle source = frame.source;
+    if (flipX) source.width = -source.width;
+    Rectangle trimmed = { dest.x + offsetX * scaleX, dest.y + frame.offset.y * scaleY,
+                          frame.source.width * scaleX, frame.source.height * scaleY };
+    DrawTexturePro(sheet->texture, source, trimmed, (Vector2){0, 0}, 0.0f, tint);
+}
@@ -0,0 +1,107 @@
+#include "texture_cache.h"
+#include "profiler.h"
+#include <stdio.h>
+#include <string.h>
+
+#define TEXTURE_CACHE_MAGIC 0x58544352u     // "RCTX" little-endian
+#define TEXTURE_CACHE_VERSION 1
+
+typedef struct TextureCacheHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t sourceHash;
+    uint32_t sourceSize;
+    int32_t width;
+    int32_t height;
+    int32_t format;         // raylib PixelFormat, whatever the decoder produced
+    uint32_t dataSize;      // pixel bytes following the header
+    uint32_t reserved;
+} TextureCacheHeader;
+
+_Static_assert(sizeof(TextureCacheHeader) == 40, "TextureCacheHeader must have no padding");
+
+// 64-bit multiply-xorshift over whole words, a megabyte PNG hashes in well under a
+// millisecond, far below what inflating it costs
+static uint64_t HashSource(const unsigned char* data, uint32_t size) {
+    uint64_t hash = 0x9E3779B97F4A7C15ull ^ size;
+    uint32_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        uint64_t word;
+        memcpy(&word, data + i, sizeof(word));
+        hash = (hash ^ word) * 0xFF51AFD7ED558CCDull;
+        hash ^= hash >> 32;
+    }
+    for (; i < size; i++) hash = (hash ^ data[i]) * 0x100000001B3ull;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    return hash ^ (hash >> 33);
+}
+
+static bool ReadCacheEntry(const char* path, uint64_t hash, uint32_t sourceSize, Image* image) {
+    FILE* file = fopen(path, "rb");
+    if (!file) return false;
+
+    TextureCacheHeader header;
+    bool ok = fread(&header, sizeof(header), 1, file) == 1
+        && header.magic == TEXTURE_CACHE_MAGIC && header.version == TEXTURE_CACHE_VERSION
+        && header.sourceHash == hash && header.sourceSize == sourceSize
+        && header.width > 0 && header.height > 0
+        && header.dataSize == (uint32_t)GetPixelDataSize(header.width, header.height, header.format);
+
+    void* pixels = ok ? MemAlloc(header.dataSize) : NULL;
+    ok = pixels && fread(pixels, 1, header.dataSize, file) == header.dataSize;
+    fclose(file);
+
+    if (!ok) {
+        MemFree(pixels);
+        return false;
+    }
+    *image = (Image){ pixels, header.width, header.height, 1, header.format };
+    return true;
+}
+
+// A failed write only costs the next run a decode, so errors are logged and dropped
+static void WriteCacheEntry(const char* path, uint64_t hash, uint32_t sourceSize, Image image) {
+    int dataSize = GetPixelDataSize(image.width, image.height, image.format);
+    TextureCacheHeader header = {
+        .magic = TEXTURE_CACHE_MAGIC,
+        .version = TEXTURE_CACHE_VERSION,
+        .sourceHash = hash,
+        .sourceSize = sourceSize,
+        .width = image.width,
+        .height = image.height,
+        .format = image.format,
+        .dataSize = (uint32_t)dataSize,
+    };
+
+    FILE* file = fopen(path, "wb");
+    if (!file && MakeDirectory(TEXTURE_CACHE_DIR) == 0) file = fopen(path, "wb");
+    bool ok = file && fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(image.data, 1, (size_t)dataSize, file) == (size_t)dataSize;
+    if (file && fclose(file) != 0) ok = false;
+
+    // a truncated entry would fail its size check anyway, but don't leave it around
+    if (!ok) {
+        if (file) remove(path);
+        TraceLog(LOG_WARNING, "TEXCACHE: could not write %s", path);
+    }
+}
+
+Image LoadImageCached(const char* fileType, const void* data, uint32_t size) {
+    uint64_t hash = HashSource(data, size);
+    char path[256];
+    snprintf(path, sizeof(path), "%s/%016llx.tex", TEXTURE_CACHE_DIR, (unsigned long long)hash);
+
+    Image image;
+    if (ReadCacheEntry(path, hash, size, &image)) return image;
+
+    TRACE_BEGIN("DecodeImage");
+    image = LoadImageFromMemory(fileType, data, (int)size);
+    TRACE_END("DecodeImage");
+
+    // mipmapped or compressed results come from container formats that upload as they are
+    if (image.data && image.mipmaps == 1 && image.format < PIXELFORMAT_COMPRESSED_DXT1_RGB) {
+        WriteCacheEntry(path, hash, size, image);
+    }
+    return image;
+}
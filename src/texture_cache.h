@@ -0,0 +1,16 @@
+#pragma once
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Decoded pixels of every image file the game loads, saved under TEXTURE_CACHE_DIR the
+// first time it is decoded. Each entry is named after a hash of the source file's bytes,
+// so an edited PNG simply misses and gets a new entry, and a hit skips the zlib inflate
+// and is a plain read of width * height * 4 bytes ready for upload.
+
+#define TEXTURE_CACHE_DIR "cache/textures"
+
+// Decodes an image file that is already in memory (fileType like ".png"), through the
+// cache. Safe on the job workers.
+Image LoadImageCached(const char* fileType, const void* data, uint32_t size);
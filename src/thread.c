@@ -0,0 +1,166 @@
+#include "thread.h"
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+struct ThreadMutex { CRITICAL_SECTION section; };
+struct ThreadCond { CONDITION_VARIABLE variable; };
+struct Thread { HANDLE handle; ThreadFunc func; void* arg; };
+
+ThreadMutex* NewMutex(void) {
+    ThreadMutex* mutex = malloc(sizeof(*mutex));
+    if (mutex) InitializeCriticalSection(&mutex->section);
+    return mutex;
+}
+
+void FreeMutex(ThreadMutex* mutex) {
+    if (!mutex) return;
+    DeleteCriticalSection(&mutex->section);
+    free(mutex);
+}
+
+void LockMutex(ThreadMutex* mutex) { EnterCriticalSection(&mutex->section); }
+void UnlockMutex(ThreadMutex* mutex) { LeaveCriticalSection(&mutex->section); }
+
+ThreadCond* NewCond(void) {
+    ThreadCond* cond = malloc(sizeof(*cond));
+    if (cond) InitializeConditionVariable(&cond->variable);
+    return cond;
+}
+
+void FreeCond(ThreadCond* cond) { free(cond); }
+void WaitCond(ThreadCond* cond, ThreadMutex* mutex) { SleepConditionVariableCS(&cond->variable, &mutex->section, INFINITE); }
+void SignalCond(ThreadCond* cond) { WakeConditionVariable(&cond->variable); }
+void BroadcastCond(ThreadCond* cond) { WakeAllConditionVariable(&cond->variable); }
+
+static DWORD WINAPI ThreadMain(LPVOID param) {
+    Thread* thread = param;
+    thread->func(thread->arg);
+    return 0;
+}
+
+Thread* StartThread(ThreadFunc func, void* arg) {
+    Thread* thread = malloc(sizeof(*thread));
+    if (!thread) return NULL;
+    thread->func = func;
+    thread->arg = arg;
+    thread->handle = CreateThread(NULL, 0, ThreadMain, thread, 0, NULL);
+    if (!thread->handle) {
+        free(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+void JoinThread(Thread* thread) {
+    WaitForSingleObject(thread->handle, INFINITE);
+    CloseHandle(thread->handle);
+    free(thread);
+}
+
+uint32_t CurrentThreadId(void) {
+    return (uint32_t)GetCurrentThreadId();
+}
+
+int32_t LoadAtomic(const volatile int32_t* value) {
+    return InterlockedCompareExchange((volatile LONG*)value, 0, 0);
+}
+
+void StoreAtomic(volatile int32_t* value, int32_t desired) {
+    InterlockedExchange((volatile LONG*)value, desired);
+}
+
+int GetProcessorCount(void) {
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int)info.dwNumberOfProcessors : 1;
+}
+
+#else
+#include <pthread.h>
+#include <unistd.h>
+
+struct ThreadMutex { pthread_mutex_t mutex; };
+struct ThreadCond { pthread_cond_t cond; };
+struct Thread { pthread_t handle; ThreadFunc func; void* arg; };
+
+ThreadMutex* NewMutex(void) {
+    ThreadMutex* mutex = malloc(sizeof(*mutex));
+    if (mutex && pthread_mutex_init(&mutex->mutex, NULL) != 0) {
+        free(mutex);
+        return NULL;
+    }
+    return mutex;
+}
+
+void FreeMutex(ThreadMutex* mutex) {
+    if (!mutex) return;
+    pthread_mutex_destroy(&mutex->mutex);
+    free(mutex);
+}
+
+void LockMutex(ThreadMutex* mutex) { pthread_mutex_lock(&mutex->mutex); }
+void UnlockMutex(ThreadMutex* mutex) { pthread_mutex_unlock(&mutex->mutex); }
+
+ThreadCond* NewCond(void) {
+    ThreadCond* cond = malloc(sizeof(*cond));
+    if (cond && pthread_cond_init(&cond->cond, NULL) != 0) {
+        free(cond);
+        return NULL;
+    }
+    return cond;
+}
+
+void FreeCond(ThreadCond* cond) {
+    if (!cond) return;
+    pthread_cond_destroy(&cond->cond);
+    free(cond);
+}
+
+void WaitCond(ThreadCond* cond, ThreadMutex* mutex) { pthread_cond_wait(&cond->cond, &mutex->mutex); }
+void SignalCond(ThreadCond* cond) { pthread_cond_signal(&cond->cond); }
+void BroadcastCond(ThreadCond* cond) { pthread_cond_broadcast(&cond->cond); }
+
+static void* ThreadMain(void* param) {
+    Thread* thread = param;
+    thread->func(thread->arg);
+    return NULL;
+}
+
+Thread* StartThread(ThreadFunc func, void* arg) {
+    Thread* thread = malloc(sizeof(*thread));
+    if (!thread) return NULL;
+    thread->func = func;
+    thread->arg = arg;
+    if (pthread_create(&thread->handle, NULL, ThreadMain, thread) != 0) {
+        free(thread);
+        return NULL;
+    }
+    return thread;
+}
+
+void JoinThread(Thread* thread) {
+    pthread_join(thread->handle, NULL);
+    free(thread);
+}
+
+uint32_t CurrentThreadId(void) {
+    return (uint32_t)(uintptr_t)pthread_self();
+}
+
+int32_t LoadAtomic(const volatile int32_t* value) {
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+void StoreAtomic(volatile int32_t* value, int32_t desired) {
+    __atomic_store_n(value, desired, __ATOMIC_SEQ_CST);
+}
+
+int GetProcessorCount(void) {
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int)count : 1;
+}
+
+#endif
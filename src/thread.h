@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Minimal threads, mutexes and condition variables over pthreads or Win32.
+// The handles are opaque so callers never see pthread.h or windows.h; kept free of
+// raylib.h because windows.h and raylib.h cannot share a translation unit.
+typedef struct ThreadMutex ThreadMutex;
+typedef struct ThreadCond ThreadCond;
+typedef struct Thread Thread;
+
+typedef void (*ThreadFunc)(void* arg);
+
+// NULL on failure
+ThreadMutex* NewMutex(void);
+void FreeMutex(ThreadMutex* mutex);
+void LockMutex(ThreadMutex* mutex);
+void UnlockMutex(ThreadMutex* mutex);
+
+ThreadCond* NewCond(void);
+void FreeCond(ThreadCond* cond);
+void WaitCond(ThreadCond* cond, ThreadMutex* mutex);
+void SignalCond(ThreadCond* cond);
+void BroadcastCond(ThreadCond* cond);
+
+// NULL if the thread could not be started. JoinThread waits for func to return and frees the handle.
+Thread* StartThread(ThreadFunc func, void* arg);
+void JoinThread(Thread* thread);
+
+uint32_t CurrentThreadId(void);
+
+// Sequentially consistent load and store, for a flag read without taking the lock that guards its writes
+int32_t LoadAtomic(const volatile int32_t* value);
+void StoreAtomic(volatile int32_t* value, int32_t desired);
+
+// Logical processors available to the process, at least 1
+int GetProcessorCount(void);
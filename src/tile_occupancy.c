@@ -0,0 +1,129 @@
+#include "tile_occupancy.h"
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+void BuildTileOccupancy(TileOccupancy* occupancy, const Level* level) {
+    memset(occupancy, 0, sizeof(*occupancy));
+    int layerCount = level->layerCount;
+    occupancy->layers = calloc(layerCount > 0 ? layerCount : 1, sizeof(OccupancyLayer));
+    occupancy->bounds = calloc(layerCount > 0 ? layerCount : 1, sizeof(Rectangle));
+    occupancy->layerCount = layerCount;
+
+    for (int i = 0; i < layerCount; i++) {
+        const LevelTileLayer* source = &level->layers[i];
+        OccupancyLayer* layer = &occupancy->layers[i];
+        if (source->rows <= 0 || source->cols <= 0) continue;   // zero bounds, never indexed
+
+        *layer = (OccupancyLayer){
+            (float)source->startX, (float)source->startY,
+            source->rows, source->cols,
+            (source->cols + 63) / 64,
+            occupancy->wordCount
+        };
+        occupancy->wordCount += layer->rows * layer->wordsPerRow;
+        occupancy->bounds[i] = (Rectangle){ layer->x, layer->y,
+            (float)(layer->cols * LEVEL_TILE_SIZE), (float)(layer->rows * LEVEL_TILE_SIZE) };
+    }
+
+    occupancy->words = calloc(occupancy->wordCount > 0 ? occupancy->wordCount : 1, sizeof(uint64_t));
+    for (int i = 0; i < layerCount; i++) {
+        const OccupancyLayer* layer = &occupancy->layers[i];
+        const uint8_t* tiles = level->tiles + level->layers[i].firstTile;
+        for (int row = 0; row < layer->rows; row++) {
+            uint64_t* words = occupancy->words + layer->firstWord + row * layer->wordsPerRow;
+            for (int col = 0; col < layer->cols; col++) {
+                if (tiles[row * layer->cols + col] == LEVEL_TILE_EMPTY) continue;
+                words[col >> 6] |= 1ull << (col & 63);
+            }
+        }
+    }
+
+    BuildCollisionGrid(&occupancy->grid, occupancy->bounds, layerCount);
+}
+
+void UnloadTileOccupancy(TileOccupancy* occupancy) {
+    UnloadCollisionGrid(&occupancy->grid);
+    free(occupancy->layers);
+    free(occupancy->bounds);
+    free(occupancy->words);
+    memset(occupancy, 0, sizeof(*occupancy));
+}
+
+// Row of a layer's bitmap, NULL outside it (outside a layer is open)
+static const uint64_t* LayerRow(const TileOccupancy* occupancy, const OccupancyLayer* layer, int row) {
+    if (row < 0 || row >= layer->rows) return NULL;
+    return occupancy->words + layer->firstWord + row * layer->wordsPerRow;
+}
+
+static bool TestBit(const uint64_t* row, int col, int cols) {
+    return row && col >= 0 && col < cols && (row[col >> 6] >> (col & 63)) & 1;
+}
+
+// Any column in [c0, c1] set in solid and clear in open
+static bool AnyFaceInSpan(const uint64_t* solid, const uint64_t* open, int c0, int c1) {
+    if (!solid) return false;
+    for (int w = c0 >> 6; w <= c1 >> 6; w++) {
+        uint64_t bits = solid[w] & ~(open ? open[w] : 0);
+        if (w == c0 >> 6) bits &= ~0ull << (c0 & 63);
+        if (w == c1 >> 6) bits &= ~0ull >> (63 - (c1 & 63));
+        if (bits) return true;
+    }
+    return false;
+}
+
+// Tiles overlapping the open interval (from, to) along an axis starting at origin, clamped
+// to [0, count). False when none do.
+static bool TileSpan(float origin, int count, float from, float to, int* first, int* last) {
+    *first = (int)floorf((from - origin) / LEVEL_TILE_SIZE);
+    *last = (int)ceilf((to - origin) / LEVEL_TILE_SIZE) - 1;
+    if (*first < 0) *first = 0;
+    if (*last > count - 1) *last = count - 1;
+    return *first <= *last;
+}
+
+bool FindTileFace(TileOccupancy* occupancy, TileFace face, float at, float from, float to, float tolerance) {
+    // padded, the grid's overlap test is strict and a face exactly tolerance away counts
+    bool horizontal = face == TILE_FACE_TOP || face == TILE_FACE_BOTTOM;
+    float reach = tolerance + 1.0f;
+    Rectangle area = horizontal
+        ? (Rectangle){ from, at - reach, to - from, reach * 2 }
+        : (Rectangle){ at - reach, from, reach * 2, to - from };
+
+    int candidates[TILE_OCCUPANCY_CANDIDATES];
+    int count = QueryCollisionGrid(&occupancy->grid, area, candidates, TILE_OCCUPANCY_CANDIDATES);
+    if (count > TILE_OCCUPANCY_CANDIDATES) {
+        TraceLog(LOG_WARNING, "OCCUPANCY: probe crosses %d layers, only the first %d are tested", count, TILE_OCCUPANCY_CANDIDATES);
+        count = TILE_OCCUPANCY_CANDIDATES;
+    }
+
+    for (int n = 0; n < count; n++) {
+        const OccupancyLayer* layer = &occupancy->layers[candidates[n]];
+        float origin = horizontal ? layer->y : layer->x;
+
+        // tile boundary nearest the probe line, faces only ever lie on one
+        int edge = (int)floorf((at - origin) / LEVEL_TILE_SIZE + 0.5f);
+        if (fabsf(at - (origin + edge * LEVEL_TILE_SIZE)) > tolerance) continue;
+
+        int first, last;
+        if (horizontal) {
+            if (!TileSpan(layer->x, layer->cols, from, to, &first, &last)) continue;
+            const uint64_t* below = LayerRow(occupancy, layer, edge);
+            const uint64_t* above = LayerRow(occupancy, layer, edge - 1);
+            bool found = face == TILE_FACE_TOP
+                ? AnyFaceInSpan(below, above, first, last)
+                : AnyFaceInSpan(above, below, first, last);
+            if (found) return true;
+        }
+        else {
+            if (!TileSpan(layer->y, layer->rows, from, to, &first, &last)) continue;
+            int solidCol = face == TILE_FACE_LEFT ? edge : edge - 1;
+            int openCol = face == TILE_FACE_LEFT ? edge - 1 : edge;
+            for (int row = first; row <= last; row++) {
+                const uint64_t* bits = LayerRow(occupancy, layer, row);
+                if (TestBit(bits, solidCol, layer->cols) && !TestBit(bits, openCol, layer->cols)) return true;
+            }
+        }
+    }
+    return false;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include "raylib.h"
+#include "collision_grid.h"
+#include "level.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TILE_OCCUPANCY_CANDIDATES 16    // layers a single probe can touch
+
+// One bit per tile, set where the tile is solid, packed row-major into 64-bit words.
+// Blocks sit at arbitrary pixel positions rather than on one shared grid, so every
+// layer keeps its own bitmap and origin; a CollisionGrid over the layer bounds finds
+// the few under a probe. Contact probes then test a whole row of tiles per word.
+typedef enum TileFace {
+    TILE_FACE_TOP = 0,      // solid below, open above: ground
+    TILE_FACE_BOTTOM,       // solid above, open below: ceiling
+    TILE_FACE_LEFT,         // solid to the right, open to the left: wall met moving right
+    TILE_FACE_RIGHT         // solid to the left, open to the right: wall met moving left
+} TileFace;
+
+typedef struct OccupancyLayer {
+    float x;                // world position of the top-left tile
+    float y;
+    int rows;
+    int cols;
+    int wordsPerRow;
+    int firstWord;          // into TileOccupancy.words
+} OccupancyLayer;
+
+typedef struct TileOccupancy {
+    OccupancyLayer* layers;
+    Rectangle* bounds;      // per layer, what the grid indexes
+    int layerCount;
+    uint64_t* words;
+    int wordCount;
+    CollisionGrid grid;
+} TileOccupancy;
+
+// Rasterizes every non-empty tile of the level's layers
+void BuildTileOccupancy(TileOccupancy* occupancy, const Level* level);
+void UnloadTileOccupancy(TileOccupancy* occupancy);
+
+// True if a face of the given kind lies within tolerance of the line at `at` (a world y
+// for top/bottom faces, x for left/right ones) and overlaps the open span (from, to)
+// along it. Faces are per layer: a layer's edge counts even where another block covers it.
+bool FindTileFace(TileOccupancy* occupancy, TileFace face, float at, float from, float to, float tolerance);
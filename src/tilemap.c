@@ -0,0 +1,222 @@
+#include "tilemap.h"
+#include "pak.h"
+#include "profiler.h"
+#include "resource_manager.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define TILEMAP_SHADER_PATH "assets/shaders/glsl330/tilemap.fs"
+
+static int ChunkCoord(float worldPos) {
+    return (int)floorf(worldPos / TILE_CHUNK_SIZE);
+}
+
+static Rectangle LayerBounds(const TileLayer* layer, int tileSize) {
+    return (Rectangle){
+        layer->startX,
+        layer->startY,
+        layer->cols * tileSize,
+        layer->rows * tileSize
+    };
+}
+
+static int FindChunk(const TileChunkCache* cache, int cx, int cy) {
+    for (int i = 0; i < cache->count; i++) {
+        if (cache->chunks[i].cx == cx && cache->chunks[i].cy == cy) return i;
+    }
+    return -1;
+}
+
+void DrawTileLayer(const TileLayer* layer, Vector2 offset, int tileSize) {
+    for (int y = 0; y < layer->rows; y++) {
+        for (int x = 0; x < layer->cols; x++) {
+            int tileIndex = layer->tiles[y * layer->cols + x];
+            if (tileIndex == LEVEL_TILE_EMPTY) continue;
+
+            Rectangle src = {
+                tileIndex * tileSize,
+                0,
+                tileSize,
+                tileSize
+            };
+
+            Rectangle dest = {
+                layer->startX + x * tileSize + offset.x,
+                layer->startY + y * tileSize + offset.y,
+                tileSize,
+                tileSize
+            };
+
+            DrawTexturePro(layer->tileset, src, dest, (Vector2){0, 0}, 0, WHITE);
+        }
+    }
+}
+
+void BakeTileChunks(TileChunkCache* cache, const TileLayer* layers, int layerCount, int tileSize) {
+    TRACE_BEGIN("BakeTileChunks");
+    cache->count = 0;
+
+    // collect every chunk touched by at least one layer (the world is sparse, so no dense grid)
+    for (int i = 0; i < layerCount; i++) {
+        Rectangle bounds = LayerBounds(&layers[i], tileSize);
+        int cx0 = ChunkCoord(bounds.x);
+        int cy0 = ChunkCoord(bounds.y);
+        int cx1 = ChunkCoord(bounds.x + bounds.width - 1);
+        int cy1 = ChunkCoord(bounds.y + bounds.height - 1);
+
+        for (int cy = cy0; cy <= cy1; cy++) {
+            for (int cx = cx0; cx <= cx1; cx++) {
+                if (FindChunk(cache, cx, cy) >= 0) continue;
+                if (cache->count >= MAX_TILE_CHUNKS) {
+                    TraceLog(LOG_WARNING, "TILEMAP: chunk limit (%d) reached, some tiles will not be drawn", MAX_TILE_CHUNKS);
+                    continue;
+                }
+                cache->chunks[cache->count++] = (TileChunk){ .cx = cx, .cy = cy };
+            }
+        }
+    }
+
+    // rasterize each chunk once, layers in declaration order so overlaps match the old draw order
+    for (int c = 0; c < cache->count; c++) {
+        TileChunk* chunk = &cache->chunks[c];
+        Rectangle chunkRect = {
+            chunk->cx * TILE_CHUNK_SIZE,
+            chunk->cy * TILE_CHUNK_SIZE,
+            TILE_CHUNK_SIZE,
+            TILE_CHUNK_SIZE
+        };
+
+        chunk->texture = LoadRenderTexture(TILE_CHUNK_SIZE, TILE_CHUNK_SIZE);
+        TrackRenderTexture("tile chunks", chunk->texture);
+        BeginTextureMode(chunk->texture);
+        ClearBackground(BLANK);
+        for (int i = 0; i < layerCount; i++) {
+            if (CheckCollisionRecs(LayerBounds(&layers[i], tileSize), chunkRect)) {
+                DrawTileLayer(&layers[i], (Vector2){-chunkRect.x, -chunkRect.y}, tileSize);
+            }
+        }
+        EndTextureMode();
+    }
+
+    TRACE_END("BakeTileChunks");
+    TraceLog(LOG_INFO, "TILEMAP: baked %d layers into %d chunks", layerCount, cache->count);
+}
+
+int DrawTileChunks(const TileChunkCache* cache, Rectangle view) {
+    int drawn = 0;
+    for (int c = 0; c < cache->count; c++) {
+        const TileChunk* chunk = &cache->chunks[c];
+        Rectangle dest = {
+            chunk->cx * TILE_CHUNK_SIZE,
+            chunk->cy * TILE_CHUNK_SIZE,
+            TILE_CHUNK_SIZE,
+            TILE_CHUNK_SIZE
+        };
+        if (!CheckCollisionRecs(dest, view)) continue;
+
+        // render textures are stored upside down, flip the source rect
+        DrawTexturePro(chunk->texture.texture,
+            (Rectangle){0, 0, TILE_CHUNK_SIZE, -TILE_CHUNK_SIZE},
+            dest,
+            (Vector2){0, 0}, 0.0f, WHITE);
+        drawn++;
+    }
+    return drawn;
+}
+
+void UnloadTileChunks(TileChunkCache* cache) {
+    for (int c = 0; c < cache->count; c++) {
+        UntrackRenderTexture("tile chunks", cache->chunks[c].texture);
+        UnloadRenderTexture(cache->chunks[c].texture);
+    }
+    cache->count = 0;
+}
+
+bool LoadGpuTileMap(GpuTileMap* map, const TileLayer* layers, int layerCount, int tileSize) {
+    memset(map, 0, sizeof(*map));
+
+    // a missing or failed shader comes back as raylib's default one, which has no tileset sampler
+    TRACE_BEGIN(TILEMAP_SHADER_PATH);
+    const char* shaderCode = FindPakFile(TILEMAP_SHADER_PATH, NULL);  // zero-terminated in the archive
+    map->shader = shaderCode ? LoadShaderFromMemory(NULL, shaderCode) : LoadShader(NULL, TILEMAP_SHADER_PATH);
+    TRACE_END(TILEMAP_SHADER_PATH);
+    map->tilesetLoc = GetShaderLocation(map->shader, "tileset");
+    if (!IsShaderValid(map->shader) || map->tilesetLoc < 0) {
+        TraceLog(LOG_WARNING, "TILEMAP: tilemap shader unavailable, using baked chunks");
+        UnloadShader(map->shader);
+        memset(map, 0, sizeof(*map));
+        return false;
+    }
+    float tileSizeValue = (float)tileSize;
+    SetShaderValue(map->shader, GetShaderLocation(map->shader, "tileSize"), &tileSizeValue, SHADER_UNIFORM_FLOAT);
+
+    map->layers = malloc(sizeof(TileLayer) * (layerCount > 0 ? layerCount : 1));
+    map->indexTextures = calloc(layerCount > 0 ? layerCount : 1, sizeof(Texture2D));
+    map->layerCount = layerCount;
+
+    TRACE_BEGIN("upload tile index textures");
+    for (int i = 0; i < layerCount; i++) {
+        map->layers[i] = layers[i];
+        map->layers[i].tiles = NULL;
+
+        // the level already stores one byte per tile, so the index map uploads as is
+        Image indices = {
+            .data = (void*)layers[i].tiles,
+            .width = layers[i].cols,
+            .height = layers[i].rows,
+            .mipmaps = 1,
+            .format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE
+        };
+        map->indexTextures[i] = LoadTextureFromImage(indices);
+        TrackTexture("tile index maps", map->indexTextures[i]);
+        SetTextureFilter(map->indexTextures[i], TEXTURE_FILTER_POINT);
+        SetTextureWrap(map->indexTextures[i], TEXTURE_WRAP_CLAMP);
+    }
+
+    TRACE_END("upload tile index textures");
+
+    TraceLog(LOG_INFO, "TILEMAP: uploaded %d layers as index textures", layerCount);
+    return true;
+}
+
+int DrawGpuTileMap(const GpuTileMap* map, Rectangle view, int tileSize) {
+    int drawn = 0;
+    unsigned int boundTileset = 0;
+
+    BeginShaderMode(map->shader);
+    for (int i = 0; i < map->layerCount; i++) {
+        const TileLayer* layer = &map->layers[i];
+        Rectangle bounds = LayerBounds(layer, tileSize);
+        if (!CheckCollisionRecs(bounds, view)) continue;
+
+        // sampler uniforms apply to the whole pending batch, flush it before switching tilesets
+        if (layer->tileset.id != boundTileset) {
+            EndShaderMode();
+            SetShaderValueTexture(map->shader, map->tilesetLoc, layer->tileset);
+            BeginShaderMode(map->shader);
+            boundTileset = layer->tileset.id;
+        }
+
+        const Texture2D indices = map->indexTextures[i];
+        DrawTexturePro(indices,
+            (Rectangle){0, 0, (float)indices.width, (float)indices.height},
+            bounds,
+            (Vector2){0, 0}, 0.0f, WHITE);
+        drawn++;
+    }
+    EndShaderMode();
+
+    return drawn;
+}
+
+void UnloadGpuTileMap(GpuTileMap* map) {
+    for (int i = 0; i < map->layerCount; i++) {
+        UntrackTexture("tile index maps", map->indexTextures[i]);
+        UnloadTexture(map->indexTextures[i]);
+    }
+    if (map->layers) UnloadShader(map->shader);
+    free(map->indexTextures);
+    free(map->layers);
+    memset(map, 0, sizeof(*map));
+}
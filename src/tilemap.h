@@ -0,0 +1,60 @@
+#pragma once
+
+#include "raylib.h"
+#include "level_format.h"
+#include <stdint.h>
+
+#define TILE_CHUNK_SIZE 1024    // world-space size (px) of one baked chunk
+#define MAX_TILE_CHUNKS 64
+
+// One block of tiles placed in the world, straight from a level layer
+typedef struct TileLayer {
+    Texture2D tileset;  // horizontal strip, tile i lives at x = i * tileSize
+    int rows;
+    int cols;
+    const uint8_t* tiles;   // rows * cols tile indices, row-major, LEVEL_TILE_EMPTY cells are skipped
+    int startX;         // world position of the top-left tile
+    int startY;
+} TileLayer;
+
+typedef struct TileChunk {
+    int cx;             // chunk grid coordinate (world / TILE_CHUNK_SIZE)
+    int cy;
+    RenderTexture2D texture;
+} TileChunk;
+
+// Static tile layers rasterized once into fixed-size world chunks
+typedef struct TileChunkCache {
+    int count;
+    TileChunk chunks[MAX_TILE_CHUNKS];
+} TileChunkCache;
+
+void DrawTileLayer(const TileLayer* layer, Vector2 offset, int tileSize);
+
+// Must be called after InitWindow and outside of any BeginTextureMode/BeginDrawing block
+void BakeTileChunks(TileChunkCache* cache, const TileLayer* layers, int layerCount, int tileSize);
+
+// Draws only chunks overlapping the world-space view, returns how many were drawn
+int DrawTileChunks(const TileChunkCache* cache, Rectangle view);
+
+void UnloadTileChunks(TileChunkCache* cache);
+
+// Shader path: each layer's tile indices are uploaded once as an R8 texture and the
+// whole layer is one quad, the fragment shader looks the tiles up in the tileset.
+// Cost no longer grows with tile count, only with the number of visible layers.
+typedef struct GpuTileMap {
+    Shader shader;
+    int tilesetLoc;
+    int layerCount;
+    TileLayer* layers;          // copies, the tile data itself is not retained
+    Texture2D* indexTextures;   // one per layer, cols x rows texels
+} GpuTileMap;
+
+// False if the tilemap shader is unavailable (e.g. a GL 2.1 build), the caller
+// then falls back to BakeTileChunks. Must be called after InitWindow.
+bool LoadGpuTileMap(GpuTileMap* map, const TileLayer* layers, int layerCount, int tileSize);
+
+// Draws layers overlapping the world-space view, returns how many were drawn
+int DrawGpuTileMap(const GpuTileMap* map, Rectangle view, int tileSize);
+
+void UnloadGpuTileMap(GpuTileMap* map);
@@ -0,0 +1,216 @@
+#include "trace.h"
+#include "profiler.h"
+#include "thread.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+typedef struct TraceEvent {
+    const char* name;
+    double time;        // seconds, GetTraceTime
+    uint32_t thread;
+    char phase;         // 'B' or 'E'
+} TraceEvent;
+
+typedef struct TraceCapture {
+    volatile int32_t active;    // read without the lock by PushEvent, written under it
+    FILE* file;
+    bool firstEvent;    // no leading comma in the JSON array
+    double startTime;
+
+    ThreadMutex* mutex;         // kept across captures, a late event may still lock it
+    ThreadCond* wake;
+    Thread* writer;
+    bool stopping;
+
+    TraceEvent ring[TRACE_RING_CAPACITY];
+    uint32_t head;      // next slot to write
+    uint32_t count;     // events waiting for the writer
+    uint32_t openScopes;    // recorded begins still waiting for their end, a slot is kept for each
+    uint32_t dropped;
+} TraceCapture;
+
+static TraceCapture capture;
+
+// Scopes this thread opened while the ring was full. Everything inside one is dropped
+// with it, so the trace only ever loses whole begin/end pairs.
+static _Thread_local uint32_t droppedDepth;
+
+double GetTraceTime(void) {
+    struct timespec ts;
+#if defined(_WIN32)
+    timespec_get(&ts, TIME_UTC);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+#endif
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+#if PROFILER_ENABLED
+
+// Names are mostly literals and asset paths, only quotes and backslashes need escaping
+static void WriteJsonString(FILE* file, const char* text) {
+    fputc('"', file);
+    for (const char* c = text; *c; c++) {
+        if (*c == '"' || *c == '\\') fputc('\\', file);
+        if ((unsigned char)*c >= 0x20) fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+static void WriteEvents(const TraceEvent* events, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        fputs(capture.firstEvent ? "\n" : ",\n", capture.file);
+        capture.firstEvent = false;
+        fputs("{\"name\":", capture.file);
+        WriteJsonString(capture.file, events[i].name);
+        fprintf(capture.file, ",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%u}",
+            events[i].phase, (events[i].time - capture.startTime) * 1e6, events[i].thread);
+    }
+}
+
+// Writer thread: sleeps until enough events are pending (or the capture stops),
+// copies them out under the lock and formats them with the lock released
+static void TraceWriterMain(void* unused) {
+    (void)unused;
+    static TraceEvent batch[TRACE_FLUSH_THRESHOLD];
+
+    for (;;) {
+        LockMutex(capture.mutex);
+        while (capture.count == 0 && !capture.stopping) WaitCond(capture.wake, capture.mutex);
+        if (capture.count == 0 && capture.stopping) {
+            UnlockMutex(capture.mutex);
+            break;
+        }
+
+        uint32_t taken = capture.count < TRACE_FLUSH_THRESHOLD ? capture.count : TRACE_FLUSH_THRESHOLD;
+        uint32_t tail = (capture.head + TRACE_RING_CAPACITY - capture.count) % TRACE_RING_CAPACITY;
+        for (uint32_t i = 0; i < taken; i++) batch[i] = capture.ring[(tail + i) % TRACE_RING_CAPACITY];
+        capture.count -= taken;
+        UnlockMutex(capture.mutex);
+
+        WriteEvents(batch, taken);
+    }
+}
+
+static void AppendEvent(const TraceEvent* event) {
+    capture.ring[capture.head] = *event;
+    capture.head = (capture.head + 1) % TRACE_RING_CAPACITY;
+    capture.count++;
+    if (capture.count == TRACE_FLUSH_THRESHOLD) SignalCond(capture.wake);
+}
+
+// Caller holds the lock
+static void RecordEvent(const TraceEvent* event) {
+    if (event->phase == 'B') {
+        // a begin only goes in with room left over for its end
+        if (droppedDepth > 0 || capture.count + capture.openScopes + 2 > TRACE_RING_CAPACITY) {
+            droppedDepth++;
+            capture.dropped++;
+        }
+        else {
+            AppendEvent(event);
+            capture.openScopes++;
+        }
+    }
+    else if (droppedDepth > 0) {
+        droppedDepth--;
+        capture.dropped++;
+    }
+    else if (capture.count == TRACE_RING_CAPACITY) {
+        capture.dropped++;      // only an end whose begin came before the capture has no slot kept
+    }
+    else {
+        AppendEvent(event);
+        if (capture.openScopes > 0) capture.openScopes--;
+    }
+}
+
+static void PushEvent(const char* name, char phase) {
+    if (!LoadAtomic(&capture.active)) return;
+
+    TraceEvent event = { name, GetTraceTime(), CurrentThreadId(), phase };
+
+    // checked again, the capture may have ended since
+    LockMutex(capture.mutex);
+    if (capture.active) RecordEvent(&event);
+    UnlockMutex(capture.mutex);
+}
+
+void TraceBegin(const char* name) {
+    PushEvent(name, 'B');
+}
+
+void TraceEnd(const char* name) {
+    PushEvent(name, 'E');
+}
+
+bool IsTraceCapturing(void) {
+    return LoadAtomic(&capture.active) != 0;
+}
+
+bool BeginTraceCapture(const char* path) {
+    if (LoadAtomic(&capture.active)) return false;
+
+    FILE* file = fopen(path, "w");
+    if (!file) {
+        fprintf(stderr, "TRACE: could not create %s\n", path);
+        return false;
+    }
+
+    capture.file = file;
+    capture.firstEvent = true;
+    capture.startTime = GetTraceTime();
+    capture.stopping = false;
+    capture.head = 0;
+    capture.count = 0;
+    capture.openScopes = 0;
+    capture.dropped = 0;
+    fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+
+    if (!capture.mutex) capture.mutex = NewMutex();
+    if (!capture.wake) capture.wake = NewCond();
+    capture.writer = capture.mutex && capture.wake ? StartThread(TraceWriterMain, NULL) : NULL;
+    if (!capture.writer) {
+        fclose(file);
+        return false;
+    }
+
+    LockMutex(capture.mutex);
+    StoreAtomic(&capture.active, 1);
+    UnlockMutex(capture.mutex);
+    return true;
+}
+
+void EndTraceCapture(void) {
+    if (!LoadAtomic(&capture.active)) return;
+
+    LockMutex(capture.mutex);
+    StoreAtomic(&capture.active, 0);
+    capture.stopping = true;
+    SignalCond(capture.wake);
+    UnlockMutex(capture.mutex);
+
+    JoinThread(capture.writer);
+
+    // the viewer shows otherData under the trace's metadata
+    fprintf(capture.file, "\n],\"otherData\":{\"droppedEvents\":\"%u\"}}\n", capture.dropped);
+    fclose(capture.file);
+    capture.file = NULL;
+    if (capture.dropped > 0) fprintf(stderr, "TRACE: ring buffer overflowed, %u events dropped\n", capture.dropped);
+}
+
+#else
+
+// Release builds without --profiler: the instrumentation points are gone, so is capture
+bool BeginTraceCapture(const char* path) {
+    fprintf(stderr, "TRACE: not compiled in, rebuild with the premake --profiler option to capture %s\n", path);
+    return false;
+}
+
+void EndTraceCapture(void) {}
+bool IsTraceCapturing(void) { return false; }
+void TraceBegin(const char* name) { (void)name; }
+void TraceEnd(const char* name) { (void)name; }
+
+#endif
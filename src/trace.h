@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdbool.h>
+
+// Chrome trace-event capture (chrome://tracing, ui.perfetto.dev). Events go into a
+// bounded ring buffer and a writer thread streams them to disk, so the main thread
+// never touches the file. Fed by the PROFILE_* and TRACE_* macros in profiler.h.
+
+#define TRACE_RING_CAPACITY 65536   // events buffered before new scopes are dropped, begin and end together
+#define TRACE_FLUSH_THRESHOLD 1024  // pending events that wake the writer thread
+
+// Starts a capture to path. False if the file can't be created or tracing is compiled out.
+bool BeginTraceCapture(const char* path);
+
+// Flushes everything still buffered, joins the writer and closes the JSON file, with
+// the number of dropped events in its otherData
+void EndTraceCapture(void);
+
+bool IsTraceCapturing(void);
+
+// Scoped events, safe from any thread. name is stored by pointer, not copied, so it
+// must stay valid until the capture ends (string literals and static tables).
+void TraceBegin(const char* name);
+void TraceEnd(const char* name);
+
+// Same monotonic clock the profiler uses, in seconds
+double GetTraceTime(void);
@@ -0,0 +1,62 @@
+#include "trigger_table.h"
+#include <stdlib.h>
+#include <string.h>
+
+void InitTriggerTable(TriggerTable* table, const TriggerBehaviour* behaviours, int typeCount) {
+    memset(table, 0, sizeof(*table));
+    table->behaviours = behaviours;
+    table->typeCount = typeCount;
+    table->step = 1;    // touchedStep 0 is never a live step
+}
+
+void UnloadTriggerTable(TriggerTable* table) {
+    free(table->volumes);
+    free(table->inside);
+    free(table->touched);
+    memset(table, 0, sizeof(*table));
+}
+
+int AddTrigger(TriggerTable* table, int type, int payload, Rectangle rect) {
+    if (table->volumeCount == table->volumeCapacity) {
+        int capacity = table->volumeCapacity ? table->volumeCapacity * 2 : 32;
+        table->volumes = realloc(table->volumes, sizeof(TriggerVolume) * capacity);
+        table->inside = realloc(table->inside, sizeof(int) * capacity);
+        table->touched = realloc(table->touched, sizeof(int) * capacity);
+        table->volumeCapacity = capacity;
+    }
+    int index = table->volumeCount++;
+    table->volumes[index] = (TriggerVolume){ rect, type, payload, false, 0 };
+    return index;
+}
+
+static void Emit(const TriggerTable* table, const TriggerVolume* volume, TriggerEvent event, void* context) {
+    if (volume->type < 0 || volume->type >= table->typeCount) return;
+    const TriggerBehaviour* behaviour = &table->behaviours[volume->type];
+    if (behaviour->handler && (behaviour->events & event)) behaviour->handler(context, volume, event);
+}
+
+void TouchTrigger(TriggerTable* table, int volume, void* context) {
+    TriggerVolume* touched = &table->volumes[volume];
+    if (touched->touchedStep == table->step) return;
+
+    touched->touchedStep = table->step;
+    table->touched[table->touchedCount++] = volume;
+    Emit(table, touched, touched->inside ? TRIGGER_STAY : TRIGGER_ENTER, context);
+    touched->inside = true;
+}
+
+void FinishTriggerStep(TriggerTable* table, void* context) {
+    for (int i = 0; i < table->insideCount; i++) {
+        TriggerVolume* volume = &table->volumes[table->inside[i]];
+        if (volume->touchedStep == table->step) continue;
+        volume->inside = false;
+        Emit(table, volume, TRIGGER_EXIT, context);
+    }
+
+    int* swap = table->inside;
+    table->inside = table->touched;
+    table->insideCount = table->touchedCount;
+    table->touched = swap;
+    table->touchedCount = 0;
+    table->step++;
+}
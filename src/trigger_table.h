@@ -0,0 +1,64 @@
+#pragma once
+
+#include "raylib.h"
+#include <stdbool.h>
+
+#define TRIGGER_MAX_TYPES 16
+
+// Volumes the player sets off by being inside them. Each one declares a type and a
+// payload (usually the index of what it stands for) and each type has one handler,
+// told only about the events it asked for: entering, every further step inside, and
+// leaving. Something else finds the overlaps and reports them with TouchTrigger; the
+// table only remembers who was inside last step, so the work per step follows the
+// volumes touched rather than the volumes in the level.
+
+typedef enum TriggerEvent {
+    TRIGGER_ENTER = 1 << 0,
+    TRIGGER_STAY = 1 << 1,      // every step inside after the one it entered on
+    TRIGGER_EXIT = 1 << 2
+} TriggerEvent;
+
+typedef struct TriggerVolume {
+    Rectangle rect;
+    int type;
+    int payload;
+    bool inside;            // touched last step
+    long long touchedStep;
+} TriggerVolume;
+
+typedef void (*TriggerHandler)(void* context, const TriggerVolume* volume, TriggerEvent event);
+
+typedef struct TriggerBehaviour {
+    TriggerHandler handler;
+    unsigned int events;    // TriggerEvent bits it wants
+} TriggerBehaviour;
+
+typedef struct TriggerTable {
+    TriggerVolume* volumes;
+    int volumeCount;
+    int volumeCapacity;
+
+    const TriggerBehaviour* behaviours;     // by type, not owned
+    int typeCount;
+
+    int* inside;            // volumes touched last step
+    int insideCount;
+    int* touched;           // this step so far
+    int touchedCount;
+    long long step;
+} TriggerTable;
+
+// behaviours must outlive the table
+void InitTriggerTable(TriggerTable* table, const TriggerBehaviour* behaviours, int typeCount);
+void UnloadTriggerTable(TriggerTable* table);
+
+// Returns the volume's index
+int AddTrigger(TriggerTable* table, int type, int payload, Rectangle rect);
+
+// The player overlaps the volume this step: runs its enter or stay handler right away.
+// A second touch in the same step is ignored.
+void TouchTrigger(TriggerTable* table, int volume, void* context);
+
+// Runs the exit handler of every volume inside last step and not touched in this one,
+// then starts the next step
+void FinishTriggerStep(TriggerTable* table, void* context);
@@ -0,0 +1,512 @@
+// Scripted, deterministic benchmark scenes. Every scene runs the real simulation
+// with generated input for a fixed number of frames, optionally renders the world
+// into a hidden window's offscreen target, and reports ns/frame for each profiler
+// zone as CSV or JSON so two builds can be diffed.
+//
+//   bench [--frames N] [--warmup N] [--scene NAME] [--format csv|json] [--out FILE]
+//         [--seed N] [--no-render] [--map FILE]
+//
+// Run from the repository root, like the game, so assets/ resolves.
+
+#include "raylib.h"
+#include "game.h"
+#include "level.h"
+#include "tilemap.h"
+#include "culling.h"
+#include "sprite_atlas.h"
+#include "profiler.h"
+#include "level_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BENCH_DEFAULT_FRAMES 1200   // 20 s of game time per scene
+#define BENCH_DEFAULT_WARMUP 120    // frames run before the counters are reset
+
+#define SYNTH_PLATFORM_ROWS 10
+#define SYNTH_PLATFORM_COLS 1000    // 10k platforms
+#define SYNTH_PLATFORM_PITCH_X 128
+#define SYNTH_PLATFORM_PITCH_Y 64
+#define SYNTH_PLATFORM_TILES 3      // platform width in tiles, one tile tall
+
+#define SYNTH_MOBS 1000
+#define SYNTH_MOB_PITCH 200
+#define SYNTH_FLOOR_Y 480
+
+#define BENCH_DOTS 10000            // eyeballs in the dots_10k scene, in the bench's own storage
+
+typedef struct BenchOptions {
+    int frames;
+    int warmup;
+    const char* scene;      // NULL runs them all
+    bool json;
+    const char* outPath;
+    uint32_t seed;
+    bool render;
+    const char* levelPath;
+} BenchOptions;
+
+typedef enum BenchLevel {
+    BENCH_LEVEL_SHIPPED = 0,
+    BENCH_LEVEL_PLATFORMS,
+    BENCH_LEVEL_MOBS
+} BenchLevel;
+
+typedef struct BenchScene {
+    const char* name;
+    BenchLevel level;
+    int startLevel;                             // 1 overworld spawn, 2 boss arena
+    void (*setup)(Game* g);                     // after game_init, may be NULL
+    void (*script)(Game* g, InputFrame* input); // before every step
+} BenchScene;
+
+// Shared by every script: the player respawns instead of ending the scene
+static void KeepPlaying(Game* g, InputFrame* input) {
+    if (!g->player.isAlive) input->pressed |= 1u << INPUT_RESET;
+}
+
+static void StandStill(Game* g, InputFrame* input) {
+    KeepPlaying(g, input);
+}
+
+static void RunAndJump(Game* g, InputFrame* input) {
+    input->down = 1u << INPUT_RIGHT;
+    if (g->stepCount % 40 == 0) input->pressed |= 1u << INPUT_JUMP;
+    KeepPlaying(g, input);
+}
+
+static void RunAndAttack(Game* g, InputFrame* input) {
+    input->down = 1u << INPUT_RIGHT;
+    if (g->stepCount % 10 == 0) input->pressed |= 1u << INPUT_ATTACK_LIGHT;
+    g->player.health = 10;     // the mobs would end the run long before the last one
+    KeepPlaying(g, input);
+}
+
+static void SpawnAllDots(Game* g) {
+    static Dot dots[BENCH_DOTS];
+    game_use_dot_storage(g, dots, BENCH_DOTS);
+    g->dotCount = BENCH_DOTS;
+    for (int i = 0; i < g->dotCount; i++) g->dots[i].timer = 6.0f;    // spawn on the first step
+}
+
+static void SurviveDots(Game* g, InputFrame* input) {
+    g->player.health = 10;     // dots hitting the player is the load being measured, not the respawn
+    KeepPlaying(g, input);
+}
+
+static void SpamDashAndLaser(Game* g, InputFrame* input) {
+    g->player.laserAcquired = true;
+    g->player.dashCount = 99;
+    g->player.health = 10;
+    input->down = 1u << ((g->stepCount / 120) % 2 ? INPUT_LEFT : INPUT_RIGHT);
+    input->pressed |= (1u << INPUT_DASH) | (1u << INPUT_LASER);
+    KeepPlaying(g, input);
+}
+
+static const BenchScene scenes[] = {
+    { "world_spawn",    BENCH_LEVEL_SHIPPED,   1, NULL,         StandStill },
+    { "boss_arena",     BENCH_LEVEL_SHIPPED,   2, NULL,         StandStill },
+    { "platforms_10k",  BENCH_LEVEL_PLATFORMS, 1, NULL,         RunAndJump },
+    { "mobs_1k",        BENCH_LEVEL_MOBS,      1, NULL,         RunAndAttack },
+    { "dots_10k",       BENCH_LEVEL_SHIPPED,   1, SpawnAllDots, SurviveDots },
+    { "dash_laser",     BENCH_LEVEL_SHIPPED,   1, NULL,         SpamDashAndLaser },
+};
+#define SCENE_COUNT ((int)(sizeof(scenes) / sizeof(scenes[0])))
+
+//==================================== Synthetic levels ====================================//
+
+// 10 rows of 1000 short ledges on the tile grid, with a matching overworld tile layer
+static void* BuildPlatformsImage(uint32_t* size) {
+    LevelWriter writer;
+    InitLevelWriter(&writer);
+    writer.header.playerSpawn = (LevelVec2){ 16, 0 };
+    writer.header.arenaSpawn = (LevelVec2){ 16, 0 };
+    writer.header.brainSpawn = (LevelRect){ 0, -4000, 100, 100 };
+
+    const int cols = SYNTH_PLATFORM_COLS * SYNTH_PLATFORM_PITCH_X / LEVEL_TILE_SIZE;
+    const int rows = SYNTH_PLATFORM_ROWS * SYNTH_PLATFORM_PITCH_Y / LEVEL_TILE_SIZE;
+    const int startY = SYNTH_PLATFORM_PITCH_Y;
+    uint8_t* tiles = malloc((size_t)rows * cols);
+    if (!tiles) return NULL;
+    memset(tiles, LEVEL_TILE_EMPTY, (size_t)rows * cols);
+
+    for (int r = 0; r < SYNTH_PLATFORM_ROWS; r++) {
+        for (int c = 0; c < SYNTH_PLATFORM_COLS; c++) {
+            LevelRect rect = {
+                (float)(c * SYNTH_PLATFORM_PITCH_X),
+                (float)(startY + r * SYNTH_PLATFORM_PITCH_Y),
+                SYNTH_PLATFORM_TILES * LEVEL_TILE_SIZE,
+                LEVEL_TILE_SIZE
+            };
+            WriteLevelRecords(&writer, LEVEL_SECTION_PLATFORMS, &rect, 1);
+
+            uint8_t* row = tiles + (size_t)(r * SYNTH_PLATFORM_PITCH_Y / LEVEL_TILE_SIZE) * cols;
+            int firstCol = c * SYNTH_PLATFORM_PITCH_X / LEVEL_TILE_SIZE;
+            row[firstCol] = LEFT_TOP_TILE;
+            for (int t = 1; t < SYNTH_PLATFORM_TILES - 1; t++) row[firstCol + t] = TOP_TILE;
+            row[firstCol + SYNTH_PLATFORM_TILES - 1] = RIGHT_TOP_TILE;
+        }
+    }
+    WriteLevelTileLayer(&writer, LEVEL_TILESET_OVERWORLD, rows, cols, 0, startY, tiles);
+    free(tiles);
+
+    void* image = BuildLevelImage(&writer, size);
+    UnloadLevelWriter(&writer);
+    return image;
+}
+
+// One long floor with a mob every few hundred pixels along it
+static void* BuildMobsImage(uint32_t* size) {
+    LevelWriter writer;
+    InitLevelWriter(&writer);
+    writer.header.playerSpawn = (LevelVec2){ 16, SYNTH_FLOOR_Y - 100 };
+    writer.header.arenaSpawn = writer.header.playerSpawn;
+    writer.header.brainSpawn = (LevelRect){ 0, -4000, 100, 100 };
+
+    const int length = (SYNTH_MOBS + 4) * SYNTH_MOB_PITCH;
+    const int cols = length / LEVEL_TILE_SIZE;
+    LevelRect floor = { 0, SYNTH_FLOOR_Y, (float)(cols * LEVEL_TILE_SIZE), LEVEL_TILE_SIZE };
+    WriteLevelRecords(&writer, LEVEL_SECTION_PLATFORMS, &floor, 1);
+
+    uint8_t* tiles = malloc(cols);
+    if (!tiles) return NULL;
+    memset(tiles, TOP_TILE, cols);
+    WriteLevelTileLayer(&writer, LEVEL_TILESET_OVERWORLD, 1, cols, 0, SYNTH_FLOOR_Y, tiles);
+    free(tiles);
+
+    // same shape as the mobs in levels/world.map
+    for (int i = 0; i < SYNTH_MOBS; i++) {
+        float x = (float)(400 + i * SYNTH_MOB_PITCH);
+        LevelMob mob = {
+            .collider = { x, SYNTH_FLOOR_Y - 50, 200, 50 },
+            .hitbox = { x, SYNTH_FLOOR_Y - 50, 20, 50 },
+            .health = 3
+        };
+        WriteLevelRecords(&writer, LEVEL_SECTION_MOBS, &mob, 1);
+    }
+
+    void* image = BuildLevelImage(&writer, size);
+    UnloadLevelWriter(&writer);
+    return image;
+}
+
+// image is set for synthetic levels and must be freed after UnloadLevel
+static bool LoadBenchLevel(BenchLevel which, const BenchOptions* options, Level* level, void** image) {
+    *image = NULL;
+    if (which == BENCH_LEVEL_SHIPPED) {
+        return LoadLevel(level, options->levelPath ? options->levelPath : LEVEL_DEFAULT_PATH);
+    }
+
+    uint32_t size = 0;
+    *image = which == BENCH_LEVEL_PLATFORMS ? BuildPlatformsImage(&size) : BuildMobsImage(&size);
+    if (!*image) return false;
+    if (!LoadLevelFromMemory(level, *image, size)) {
+        free(*image);
+        *image = NULL;
+        return false;
+    }
+    return true;
+}
+
+//==================================== Offscreen render ====================================//
+
+typedef struct BenchRenderer {
+    RenderTexture2D target;
+    Texture2D tilesets[LEVEL_TILESET_COUNT];
+    SpriteSheet player;
+    SpriteSheet mob;
+    SpriteAtlas sprites;
+    GpuTileMap gpuTiles;
+    TileChunkCache chunks;      // large, the renderer itself is static
+    bool useGpuTiles;
+} BenchRenderer;
+
+static bool InitBenchRenderer(BenchRenderer* r) {
+    SetTraceLogLevel(LOG_WARNING);
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(VIRTUAL_WIDTH, VIRTUAL_HEIGHT, "bench");
+    if (!IsWindowReady()) return false;
+
+    r->target = LoadRenderTexture(VIRTUAL_WIDTH, VIRTUAL_HEIGHT);
+    r->tilesets[LEVEL_TILESET_OVERWORLD] = LoadTexture("assets/map/tileset.png");
+    r->tilesets[LEVEL_TILESET_ARENA] = LoadTexture("assets/map/boss_arena_tileset.png");
+    LoadSpriteSheet(&r->player, "assets/hero/hero.png", 14, 8);
+    LoadSpriteSheet(&r->mob, "assets/enemies/eyehead.png", 10, 6);
+    LoadSpriteAtlas(&r->sprites);
+    return true;
+}
+
+static void CloseBenchRenderer(BenchRenderer* r) {
+    UnloadSpriteAtlas(&r->sprites);
+    UnloadSpriteSheet(&r->mob);
+    UnloadSpriteSheet(&r->player);
+    for (int i = 0; i < LEVEL_TILESET_COUNT; i++) UnloadTexture(r->tilesets[i]);
+    UnloadRenderTexture(r->target);
+    CloseWindow();
+}
+
+static void LoadSceneTiles(BenchRenderer* r, const Level* level) {
+    TileLayer* layers = malloc(sizeof(TileLayer) * (level->layerCount > 0 ? level->layerCount : 1));
+    for (int i = 0; i < level->layerCount; i++) {
+        const LevelTileLayer* layer = &level->layers[i];
+        layers[i] = (TileLayer){
+            r->tilesets[layer->tileset],
+            layer->rows,
+            layer->cols,
+            level->tiles + layer->firstTile,
+            layer->startX,
+            layer->startY
+        };
+    }
+    r->useGpuTiles = LoadGpuTileMap(&r->gpuTiles, layers, level->layerCount, LEVEL_TILE_SIZE);
+    if (!r->useGpuTiles) BakeTileChunks(&r->chunks, layers, level->layerCount, LEVEL_TILE_SIZE);
+    free(layers);
+}
+
+static void UnloadSceneTiles(BenchRenderer* r) {
+    if (r->useGpuTiles) UnloadGpuTileMap(&r->gpuTiles);
+    else UnloadTileChunks(&r->chunks);
+}
+
+// The world pass of main.c without backgrounds, menus or dialogue: what scales with level content
+static void DrawBenchFrame(BenchRenderer* r, Game* g) {
+    Rectangle view = GetCameraViewRect(g->camera, VIRTUAL_WIDTH, VIRTUAL_HEIGHT);
+    CullStats cull = {0};
+
+    PROFILE_BEGIN(PROFILE_WORLD_DRAW);
+    BeginTextureMode(r->target);
+    ClearBackground(RAYWHITE);
+    BeginMode2D(g->camera);
+
+    if (r->useGpuTiles) DrawGpuTileMap(&r->gpuTiles, view, LEVEL_TILE_SIZE);
+    else DrawTileChunks(&r->chunks, view);
+
+    for (int i = 0; i < g->damageBlockCount; i++) {
+        if (IsVisible(&cull, view, g->damageBlock[i])) DrawSprite(&r->sprites, SPRITE_DAMAGE_BLOCK, g->damageBlock[i], WHITE);
+    }
+    for (int i = 0; i < g->dotCount; i++) {
+        if (!g->dots[i].active) continue;
+        Rectangle dotRect = {g->dots[i].pos.x - DOT_RADIUS, g->dots[i].pos.y - DOT_RADIUS, DOT_RADIUS * 2, DOT_RADIUS * 2};
+        if (IsVisible(&cull, view, dotRect)) DrawSprite(&r->sprites, SPRITE_EYEBALL, dotRect, WHITE);
+    }
+    for (int i = 0; i < g->dashCount; i++) {
+        if (!g->Dashes[i].isCollected && IsVisible(&cull, view, g->Dashes[i].rect)) DrawSprite(&r->sprites, SPRITE_DASH, g->Dashes[i].rect, WHITE);
+    }
+
+    SheetFrame playerFrame = animation_sheet_frame(&g->player_anim, &r->player);
+    DrawSheetFrame(&r->player, playerFrame,
+        (Rectangle){g->player.rect.x + g->player.rect.width / 2 - PLAYER_DRAW_SIZE / 2,
+                    g->player.rect.y + g->player.rect.height / 2 - PLAYER_DRAW_SIZE / 2,
+                    PLAYER_DRAW_SIZE, PLAYER_DRAW_SIZE},
+        g->direction < 0, WHITE);
+
+    for (int i = 0; i < g->mobs.count; i++) {
+        Rectangle mobDest = {g->mobs.hitbox[i].x + g->mobs.hitbox[i].width / 2 - MOB_DRAW_SIZE / 2,
+                             g->mobs.hitbox[i].y + g->mobs.hitbox[i].height / 2 - MOB_DRAW_SIZE / 2,
+                             MOB_DRAW_SIZE, MOB_DRAW_SIZE - 50};
+        if (IsVisible(&cull, view, mobDest)) DrawSheetFrame(&r->mob, animation_sheet_frame(&g->mobs.anim[i], &r->mob), mobDest, false, WHITE);
+    }
+
+    if (g->laserActive) DrawSprite(&r->sprites, SPRITE_LASER, g->laserRect, WHITE);
+
+    EndMode2D();
+    EndTextureMode();
+    PROFILE_END(PROFILE_WORLD_DRAW);
+
+    // no letterboxing, the hidden window is the virtual target's size
+    BeginDrawing();
+    PROFILE_BEGIN(PROFILE_BLIT);
+    DrawTextureRec(r->target.texture, (Rectangle){0, 0, VIRTUAL_WIDTH, -VIRTUAL_HEIGHT}, (Vector2){0, 0}, WHITE);
+    PROFILE_END(PROFILE_BLIT);
+    PROFILE_BEGIN(PROFILE_PRESENT);
+    EndDrawing();
+    PROFILE_END(PROFILE_PRESENT);
+}
+
+//==================================== Running and reporting ===============================//
+
+typedef struct SceneResult {
+    long long frames;
+    double frameSeconds;    // wall time of whole frames, sim and render
+    double zoneSeconds[PROFILE_ZONE_COUNT];
+    ProfileStats zoneStats[PROFILE_ZONE_COUNT];
+    uint32_t mobs;
+    uint32_t platforms;
+} SceneResult;
+
+static bool RunScene(const BenchScene* scene, const BenchOptions* options, BenchRenderer* renderer, SceneResult* result) {
+    static Game game;   // large, keep it off the stack
+    Level level;
+    void* image;
+    if (!LoadBenchLevel(scene->level, options, &level, &image)) {
+        fprintf(stderr, "bench: %s: could not load its level\n", scene->name);
+        return false;
+    }
+
+    game_init(&game, options->seed, &level);
+    if (scene->setup) scene->setup(&game);
+    if (renderer) LoadSceneTiles(renderer, &level);
+
+    InputFrame input = {0};
+    double start = 0.0;
+    for (int frame = 0; frame < options->warmup + options->frames; frame++) {
+        if (frame == options->warmup) {
+            ResetProfiler();
+            start = GetTraceTime();
+        }
+
+        input.down = 0;
+        input.mouseVirtual = (Vector2){VIRTUAL_WIDTH / 2.0f, VIRTUAL_HEIGHT / 2.0f};
+        if (frame == 0) input.startLevel = scene->startLevel;
+        scene->script(&game, &input);
+        input.down |= input.pressed;
+
+        PROFILE_BEGIN(PROFILE_SIM);
+        game_step(&game, &input);
+        PROFILE_END(PROFILE_SIM);
+        ConsumeInputPresses(&input);
+
+        if (renderer) DrawBenchFrame(renderer, &game);
+        PROFILE_FRAME_END();
+    }
+
+    result->frames = GetProfiledFrames();
+    result->frameSeconds = GetTraceTime() - start;
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        result->zoneSeconds[z] = GetProfileTotal(z);
+        result->zoneStats[z] = GetProfileStats(z);
+    }
+    result->mobs = game.mobs.count;
+    result->platforms = game.platformCount;
+
+    if (renderer) UnloadSceneTiles(renderer);
+    game_shutdown(&game);
+    UnloadLevel(&level);
+    free(image);
+    return true;
+}
+
+// Zones the scene never entered (input, hud, the render ones with --no-render) are left out
+static bool ZoneMeasured(const SceneResult* result, int zone) {
+    return result->zoneSeconds[zone] > 0.0;
+}
+
+static void WriteCsv(FILE* out, const BenchScene* scene, const SceneResult* result, bool header) {
+    if (header) fputs("scene,zone,frames,avg_ns,min_ns,p99_ns\n", out);
+
+    double frames = result->frames > 0 ? (double)result->frames : 1.0;
+    fprintf(out, "%s,frame,%lld,%.0f,,\n", scene->name, result->frames, result->frameSeconds * 1e9 / frames);
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        if (!ZoneMeasured(result, z)) continue;
+        fprintf(out, "%s,%s,%lld,%.0f,%.0f,%.0f\n", scene->name, GetProfileZoneName(z), result->frames,
+            result->zoneSeconds[z] * 1e9 / frames, result->zoneStats[z].min * 1e6, result->zoneStats[z].p99 * 1e6);
+    }
+}
+
+static void WriteJson(FILE* out, const BenchScene* scene, const SceneResult* result, bool first) {
+    double frames = result->frames > 0 ? (double)result->frames : 1.0;
+    fprintf(out, "%s\n    {\"scene\":\"%s\",\"frames\":%lld,\"platforms\":%u,\"mobs\":%u,\"frame_ns\":%.0f,\"zones\":{",
+        first ? "" : ",", scene->name, result->frames, result->platforms, result->mobs, result->frameSeconds * 1e9 / frames);
+
+    bool firstZone = true;
+    for (int z = 0; z < PROFILE_ZONE_COUNT; z++) {
+        if (!ZoneMeasured(result, z)) continue;
+        fprintf(out, "%s\n      \"%s\":{\"avg_ns\":%.0f,\"min_ns\":%.0f,\"p99_ns\":%.0f}", firstZone ? "" : ",",
+            GetProfileZoneName(z), result->zoneSeconds[z] * 1e9 / frames,
+            result->zoneStats[z].min * 1e6, result->zoneStats[z].p99 * 1e6);
+        firstZone = false;
+    }
+    fputs("\n    }}", out);
+}
+
+static void Usage(void) {
+    fputs("usage: bench [--frames N] [--warmup N] [--scene NAME] [--format csv|json] [--out FILE] [--seed N] [--no-render] [--map FILE]\nscenes:", stderr);
+    for (int i = 0; i < SCENE_COUNT; i++) fprintf(stderr, " %s", scenes[i].name);
+    fputc('\n', stderr);
+}
+
+static bool ParseBenchOptions(int argc, char** argv, BenchOptions* options) {
+    *options = (BenchOptions){ .frames = BENCH_DEFAULT_FRAMES, .warmup = BENCH_DEFAULT_WARMUP, .seed = 1, .render = true };
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : NULL;
+
+        if (strcmp(arg, "--no-render") == 0) {
+            options->render = false;
+            continue;
+        }
+        if (!value) return false;
+        i++;
+
+        if (strcmp(arg, "--frames") == 0) options->frames = atoi(value);
+        else if (strcmp(arg, "--warmup") == 0) options->warmup = atoi(value);
+        else if (strcmp(arg, "--scene") == 0) options->scene = value;
+        else if (strcmp(arg, "--out") == 0) options->outPath = value;
+        else if (strcmp(arg, "--seed") == 0) options->seed = (uint32_t)strtoul(value, NULL, 10);
+        else if (strcmp(arg, "--map") == 0) options->levelPath = value;
+        else if (strcmp(arg, "--format") == 0) {
+            if (strcmp(value, "json") == 0) options->json = true;
+            else if (strcmp(value, "csv") != 0) return false;
+        }
+        else return false;
+    }
+    return options->frames > 0 && options->warmup >= 0;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    if (!ParseBenchOptions(argc, argv, &options)) {
+        Usage();
+        return 1;
+    }
+
+    FILE* out = options.outPath ? fopen(options.outPath, "w") : stdout;
+    if (!out) {
+        fprintf(stderr, "bench: could not create %s\n", options.outPath);
+        return 1;
+    }
+
+    static BenchRenderer renderer;
+    if (options.render && !InitBenchRenderer(&renderer)) {
+        fputs("bench: no window available, run with --no-render\n", stderr);
+        return 1;
+    }
+
+#if defined(NDEBUG)
+    const char* build = "release";
+#else
+    const char* build = "debug";
+#endif
+    if (options.json) {
+        fprintf(out, "{\"build\":\"%s\",\"render\":%s,\"seed\":%u,\"warmup\":%d,\"scenes\":[",
+            build, options.render ? "true" : "false", options.seed, options.warmup);
+    }
+
+    int ran = 0;
+    int failed = 0;
+    for (int i = 0; i < SCENE_COUNT; i++) {
+        if (options.scene && strcmp(options.scene, scenes[i].name) != 0) continue;
+
+        SceneResult result = {0};
+        if (!RunScene(&scenes[i], &options, options.render ? &renderer : NULL, &result)) {
+            failed++;
+            continue;
+        }
+        if (options.json) WriteJson(out, &scenes[i], &result, ran == 0);
+        else WriteCsv(out, &scenes[i], &result, ran == 0);
+        fflush(out);
+        ran++;
+    }
+
+    if (options.json) fputs("\n]}\n", out);
+    if (out != stdout) fclose(out);
+    if (options.render) CloseBenchRenderer(&renderer);
+
+    if (ran == 0 && failed == 0) {
+        fprintf(stderr, "bench: no scene named %s\n", options.scene);
+        Usage();
+        return 1;
+    }
+    return failed > 0 ? 1 : 0;
+}
@@ -0,0 +1,81 @@
+#include "level_writer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static uint32_t AlignUp(uint32_t value) {
+    return (value + LEVEL_ALIGN - 1) & ~(uint32_t)(LEVEL_ALIGN - 1);
+}
+
+void InitLevelWriter(LevelWriter* writer) {
+    memset(writer, 0, sizeof(*writer));
+    writer->header.magic = LEVEL_MAGIC;
+    writer->header.version = LEVEL_VERSION;
+    writer->header.sectionCount = LEVEL_SECTION_COUNT;
+}
+
+void UnloadLevelWriter(LevelWriter* writer) {
+    for (int s = 0; s < LEVEL_SECTION_COUNT; s++) free(writer->data[s]);
+    memset(writer, 0, sizeof(*writer));
+}
+
+void WriteLevelRecords(LevelWriter* writer, LevelSectionId section, const void* records, uint32_t count) {
+    uint32_t recordSize = LevelRecordSize(section);
+    uint32_t needed = writer->count[section] + count;
+
+    if (needed > writer->capacity[section]) {
+        uint32_t capacity = writer->capacity[section] ? writer->capacity[section] : 16;
+        while (capacity < needed) capacity *= 2;
+        unsigned char* data = realloc(writer->data[section], (size_t)capacity * recordSize);
+        if (!data) return;
+        writer->data[section] = data;
+        writer->capacity[section] = capacity;
+    }
+
+    memcpy(writer->data[section] + (size_t)writer->count[section] * recordSize, records, (size_t)count * recordSize);
+    writer->count[section] = needed;
+}
+
+void WriteLevelTileLayer(LevelWriter* writer, LevelTileset tileset, int rows, int cols, int startX, int startY, const uint8_t* tiles) {
+    LevelTileLayer layer = {
+        .tileset = tileset,
+        .rows = rows,
+        .cols = cols,
+        .startX = startX,
+        .startY = startY,
+        .firstTile = writer->count[LEVEL_SECTION_TILES],
+    };
+    WriteLevelRecords(writer, LEVEL_SECTION_TILES, tiles, (uint32_t)(rows * cols));
+    WriteLevelRecords(writer, LEVEL_SECTION_LAYERS, &layer, 1);
+}
+
+void* BuildLevelImage(const LevelWriter* writer, uint32_t* size) {
+    LevelHeader header = writer->header;
+
+    uint32_t offset = AlignUp(sizeof(LevelHeader));
+    for (int s = 0; s < LEVEL_SECTION_COUNT; s++) {
+        header.sections[s].offset = offset;
+        header.sections[s].count = writer->count[s];
+        offset = AlignUp(offset + writer->count[s] * LevelRecordSize(s));
+    }
+    header.fileSize = offset;
+
+    unsigned char* image = calloc(1, offset);
+    if (!image) return NULL;
+
+    memcpy(image, &header, sizeof(header));
+    for (int s = 0; s < LEVEL_SECTION_COUNT; s++) {
+        if (writer->count[s] == 0) continue;
+        memcpy(image + header.sections[s].offset, writer->data[s], (size_t)writer->count[s] * LevelRecordSize(s));
+    }
+
+    *size = offset;
+    return image;
+}
+
+bool SaveLevelImage(const void* image, uint32_t size, const char* path) {
+    FILE* file = fopen(path, "wb");
+    if (!file) return false;
+    bool ok = fwrite(image, 1, size, file) == size;
+    return fclose(file) == 0 && ok;
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "level_format.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+// Accumulates records per section, then lays them out as one .lvl image.
+// Lives with levelc, the game itself only ever reads levels.
+typedef struct LevelWriter {
+    LevelHeader header;     // spawns are filled in by the caller
+    unsigned char* data[LEVEL_SECTION_COUNT];
+    uint32_t count[LEVEL_SECTION_COUNT];
+    uint32_t capacity[LEVEL_SECTION_COUNT];
+} LevelWriter;
+
+void InitLevelWriter(LevelWriter* writer);
+void UnloadLevelWriter(LevelWriter* writer);
+
+// Appends count records of LevelRecordSize(section) bytes each
+void WriteLevelRecords(LevelWriter* writer, LevelSectionId section, const void* records, uint32_t count);
+
+// Appends rows * cols tile indices and a layer pointing at them
+void WriteLevelTileLayer(LevelWriter* writer, LevelTileset tileset, int rows, int cols, int startX, int startY, const uint8_t* tiles);
+
+// Returns a malloc'd file image (free with free), or NULL on allocation failure
+void* BuildLevelImage(const LevelWriter* writer, uint32_t* size);
+
+bool SaveLevelImage(const void* image, uint32_t size, const char* path);
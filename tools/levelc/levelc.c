@@ -0,0 +1,351 @@
+// levelc: compiles a text level source into the .lvl image the game maps at startup.
+//
+//   levelc <source.map> <output.lvl>
+//
+// A source is line based, '#' starts a comment. Coordinates are world pixels.
+//
+//   player_spawn X Y
+//   arena_spawn X Y
+//   brain X Y W H
+//   block overworld|arena X Y      tile grid with its top-left tile at X,Y,
+//   ...csv rows...                 one row per line, closed by "end"
+//   end
+//   checkpoint X Y W H
+//   damage X Y W H
+//   mob X Y W H HITBOX_W HITBOX_H HEALTH
+//   pickup double_jump|dash|noclip|levitation X Y W H
+//   dialogue PARAM X Y W H
+//   teleport AX AY AW AH BX BY BW BH
+//
+// Grid cells are 0 (empty), any other number (solid, edge tile picked from the
+// neighbouring cells, so Tiled CSV layers can be pasted as is) or a TILE_TYPE name
+// without the _TILE suffix (solid, that exact tile, for seams hidden under an
+// overlapping block). Collision is never written by hand: each block's solid cells
+// are merged into as few rectangles as possible and emitted as platforms.
+
+#include "level_writer.h"
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LINE 4096
+#define MAX_TOKENS 16
+#define CELL_AUTO 0xFE      // solid cell whose tile is picked by AutoTile
+
+typedef struct Source {
+    const char* path;
+    FILE* file;
+    int line;
+} Source;
+
+typedef struct Block {
+    LevelTileset tileset;
+    int startX;
+    int startY;
+    int rows;
+    int cols;
+    uint8_t* cells;     // rows * cols, LEVEL_TILE_EMPTY, CELL_AUTO or a TILE_TYPE
+    int capacity;
+} Block;
+
+static const char* tileNames[] = {
+    [TOP_TILE] = "TOP",
+    [LEFT_TILE] = "LEFT",
+    [RIGHT_TILE] = "RIGHT",
+    [BOTTOM_TILE] = "BOTTOM",
+    [CENTER_TILE] = "CENTER",
+    [LEFT_TOP_TILE] = "LEFT_TOP",
+    [RIGHT_TOP_TILE] = "RIGHT_TOP",
+    [LEFT_BOTTOM_TILE] = "LEFT_BOTTOM",
+    [RIGHT_BOTTOM_TILE] = "RIGHT_BOTTOM",
+    [TOP_LEFT_ANGLE] = "TOP_LEFT_ANGLE",
+    [RIGHT_BOTTOM_ANGLE] = "RIGHT_BOTTOM_ANGLE",
+};
+
+static const char* tilesetNames[LEVEL_TILESET_COUNT] = { "overworld", "arena" };
+static const char* pickupNames[LEVEL_PICKUP_COUNT] = { "double_jump", "dash", "noclip", "levitation" };
+
+#define COUNT_OF(array) (int)(sizeof(array) / sizeof((array)[0]))
+
+static void Fail(const Source* source, const char* message, const char* detail) {
+    fprintf(stderr, "%s:%d: %s%s%s\n", source->path, source->line, message, detail ? ": " : "", detail ? detail : "");
+    exit(1);
+}
+
+// Reads the next non-blank line with its comment stripped, false at end of file
+static bool ReadLine(Source* source, char* line) {
+    while (fgets(line, MAX_LINE, source->file)) {
+        source->line++;
+        char* comment = strchr(line, '#');
+        if (comment) *comment = '\0';
+
+        char* start = line;
+        while (isspace((unsigned char)*start)) start++;
+        char* end = start + strlen(start);
+        while (end > start && isspace((unsigned char)end[-1])) end--;
+        *end = '\0';
+
+        if (*start == '\0') continue;
+        memmove(line, start, (size_t)(end - start) + 1);
+        return true;
+    }
+    return false;
+}
+
+static int SplitTokens(char* line, const char* separators, char** tokens) {
+    int count = 0;
+    for (char* token = strtok(line, separators); token; token = strtok(NULL, separators)) {
+        if (count < MAX_TOKENS) tokens[count] = token;
+        count++;
+    }
+    return count;
+}
+
+static float ParseNumber(const Source* source, const char* token) {
+    char* end;
+    float value = strtof(token, &end);
+    if (end == token || *end != '\0') Fail(source, "expected a number", token);
+    return value;
+}
+
+static int ParseName(const Source* source, const char* token, const char** names, int count) {
+    for (int i = 0; i < count; i++) {
+        if (names[i] && strcmp(token, names[i]) == 0) return i;
+    }
+    Fail(source, "unknown name", token);
+    return -1;
+}
+
+static LevelRect ParseRect(const Source* source, char** tokens) {
+    LevelRect rect = {
+        ParseNumber(source, tokens[0]),
+        ParseNumber(source, tokens[1]),
+        ParseNumber(source, tokens[2]),
+        ParseNumber(source, tokens[3])
+    };
+    if (rect.width < 0 || rect.height < 0) Fail(source, "rectangle has a negative size", NULL);
+    return rect;
+}
+
+static uint8_t ParseCell(const Source* source, const char* token) {
+    if (isdigit((unsigned char)token[0]) || token[0] == '-') {
+        return ParseNumber(source, token) > 0 ? CELL_AUTO : LEVEL_TILE_EMPTY;
+    }
+    return (uint8_t)ParseName(source, token, tileNames, COUNT_OF(tileNames));
+}
+
+static void ReadBlockRows(Source* source, Block* block) {
+    char line[MAX_LINE];
+    char* tokens[MAX_LINE / 2];
+
+    while (ReadLine(source, line)) {
+        if (strcmp(line, "end") == 0) {
+            if (block->rows == 0) Fail(source, "block has no rows", NULL);
+            return;
+        }
+
+        int cols = 0;
+        for (char* token = strtok(line, ", \t"); token; token = strtok(NULL, ", \t")) tokens[cols++] = token;
+        if (block->rows == 0) block->cols = cols;
+        if (cols != block->cols) Fail(source, "row width differs from the first row", NULL);
+
+        int needed = (block->rows + 1) * block->cols;
+        if (needed > block->capacity) {
+            block->capacity = needed * 2;
+            block->cells = realloc(block->cells, (size_t)block->capacity);
+            if (!block->cells) Fail(source, "out of memory", NULL);
+        }
+        for (int x = 0; x < cols; x++) {
+            block->cells[block->rows * block->cols + x] = ParseCell(source, tokens[x]);
+        }
+        block->rows++;
+    }
+    Fail(source, "block is missing its \"end\"", NULL);
+}
+
+static bool Solid(const Block* block, int x, int y) {
+    if (x < 0 || y < 0 || x >= block->cols || y >= block->rows) return false;
+    return block->cells[y * block->cols + x] != LEVEL_TILE_EMPTY;
+}
+
+// Edge tile for a solid cell from its 4 neighbours; the tileset only has inner
+// corners for the top-left and bottom-right, other inner corners stay CENTER
+static uint8_t AutoTile(const Block* block, int x, int y) {
+    bool up = Solid(block, x, y - 1);
+    bool down = Solid(block, x, y + 1);
+    bool left = Solid(block, x - 1, y);
+    bool right = Solid(block, x + 1, y);
+
+    if (!up && !left) return LEFT_TOP_TILE;
+    if (!up && !right) return RIGHT_TOP_TILE;
+    if (!down && !left) return LEFT_BOTTOM_TILE;
+    if (!down && !right) return RIGHT_BOTTOM_TILE;
+    if (!up) return TOP_TILE;
+    if (!down) return BOTTOM_TILE;
+    if (!left) return LEFT_TILE;
+    if (!right) return RIGHT_TILE;
+    if (!Solid(block, x - 1, y - 1)) return TOP_LEFT_ANGLE;
+    if (!Solid(block, x + 1, y + 1)) return RIGHT_BOTTOM_ANGLE;
+    return CENTER_TILE;
+}
+
+// Greedy merge: grow each uncovered solid cell right as far as it goes, then down
+// while the whole span stays solid. Not always the true minimum, but exact for the
+// rectangular and L-shaped blocks levels are made of.
+static int MergeCollision(const Block* block, LevelWriter* writer) {
+    bool* covered = calloc((size_t)(block->rows * block->cols), sizeof(bool));
+    int rects = 0;
+
+    for (int y = 0; y < block->rows; y++) {
+        for (int x = 0; x < block->cols; x++) {
+            if (!Solid(block, x, y) || covered[y * block->cols + x]) continue;
+
+            int width = 1;
+            while (Solid(block, x + width, y) && !covered[y * block->cols + x + width]) width++;
+
+            int height = 1;
+            for (bool grow = true; grow && y + height < block->rows; ) {
+                for (int i = 0; i < width; i++) {
+                    if (!Solid(block, x + i, y + height) || covered[(y + height) * block->cols + x + i]) grow = false;
+                }
+                if (grow) height++;
+            }
+
+            for (int j = 0; j < height; j++) {
+                for (int i = 0; i < width; i++) covered[(y + j) * block->cols + x + i] = true;
+            }
+
+            LevelRect rect = {
+                (float)(block->startX + x * LEVEL_TILE_SIZE),
+                (float)(block->startY + y * LEVEL_TILE_SIZE),
+                (float)(width * LEVEL_TILE_SIZE),
+                (float)(height * LEVEL_TILE_SIZE)
+            };
+            WriteLevelRecords(writer, LEVEL_SECTION_PLATFORMS, &rect, 1);
+            rects++;
+        }
+    }
+
+    free(covered);
+    return rects;
+}
+
+static void CompileBlock(Block* block, LevelWriter* writer) {
+    uint8_t* tiles = malloc((size_t)(block->rows * block->cols));
+    for (int y = 0; y < block->rows; y++) {
+        for (int x = 0; x < block->cols; x++) {
+            uint8_t cell = block->cells[y * block->cols + x];
+            tiles[y * block->cols + x] = cell == CELL_AUTO ? AutoTile(block, x, y) : cell;
+        }
+    }
+    WriteLevelTileLayer(writer, block->tileset, block->rows, block->cols, block->startX, block->startY, tiles);
+    free(tiles);
+}
+
+static void ExpectTokens(const Source* source, int count, int expected, const char* directive) {
+    if (count != expected) Fail(source, "wrong number of values for", directive);
+}
+
+static void CompileSource(Source* source, LevelWriter* writer) {
+    char line[MAX_LINE];
+    char* tokens[MAX_TOKENS];
+    Block block = {0};
+    int blocks = 0;
+    int rects = 0;
+
+    while (ReadLine(source, line)) {
+        int count = SplitTokens(line, " \t", tokens);
+        const char* directive = tokens[0];
+        char** args = tokens + 1;
+        count--;
+
+        if (strcmp(directive, "player_spawn") == 0 || strcmp(directive, "arena_spawn") == 0) {
+            ExpectTokens(source, count, 2, directive);
+            LevelVec2 spawn = { ParseNumber(source, args[0]), ParseNumber(source, args[1]) };
+            if (directive[0] == 'p') writer->header.playerSpawn = spawn;
+            else writer->header.arenaSpawn = spawn;
+        }
+        else if (strcmp(directive, "brain") == 0) {
+            ExpectTokens(source, count, 4, directive);
+            writer->header.brainSpawn = ParseRect(source, args);
+        }
+        else if (strcmp(directive, "block") == 0) {
+            ExpectTokens(source, count, 3, directive);
+            block.tileset = ParseName(source, args[0], tilesetNames, LEVEL_TILESET_COUNT);
+            block.startX = (int)ParseNumber(source, args[1]);
+            block.startY = (int)ParseNumber(source, args[2]);
+            block.rows = 0;
+            block.cols = 0;
+            ReadBlockRows(source, &block);
+            CompileBlock(&block, writer);
+            rects += MergeCollision(&block, writer);
+            blocks++;
+        }
+        else if (strcmp(directive, "checkpoint") == 0 || strcmp(directive, "damage") == 0) {
+            ExpectTokens(source, count, 4, directive);
+            LevelRect rect = ParseRect(source, args);
+            WriteLevelRecords(writer, directive[0] == 'c' ? LEVEL_SECTION_CHECKPOINTS : LEVEL_SECTION_DAMAGE, &rect, 1);
+        }
+        else if (strcmp(directive, "mob") == 0) {
+            ExpectTokens(source, count, 7, directive);
+            LevelMob mob = { .collider = ParseRect(source, args) };
+            mob.hitbox = (LevelRect){ mob.collider.x, mob.collider.y, ParseNumber(source, args[4]), ParseNumber(source, args[5]) };
+            mob.health = (int32_t)ParseNumber(source, args[6]);
+            if (mob.health <= 0) Fail(source, "mob health must be positive", NULL);
+            WriteLevelRecords(writer, LEVEL_SECTION_MOBS, &mob, 1);
+        }
+        else if (strcmp(directive, "pickup") == 0) {
+            ExpectTokens(source, count, 5, directive);
+            LevelPickup pickup = { (uint32_t)ParseName(source, args[0], pickupNames, LEVEL_PICKUP_COUNT), ParseRect(source, args + 1) };
+            WriteLevelRecords(writer, LEVEL_SECTION_PICKUPS, &pickup, 1);
+        }
+        else if (strcmp(directive, "dialogue") == 0) {
+            ExpectTokens(source, count, 5, directive);
+            LevelTrigger trigger = { LEVEL_TRIGGER_DIALOGUE, (uint32_t)ParseNumber(source, args[0]), ParseRect(source, args + 1) };
+            WriteLevelRecords(writer, LEVEL_SECTION_TRIGGERS, &trigger, 1);
+        }
+        else if (strcmp(directive, "teleport") == 0) {
+            ExpectTokens(source, count, 8, directive);
+            LevelTeleport teleport = { ParseRect(source, args), ParseRect(source, args + 4) };
+            WriteLevelRecords(writer, LEVEL_SECTION_TELEPORTS, &teleport, 1);
+        }
+        else {
+            Fail(source, "unknown directive", directive);
+        }
+    }
+
+    free(block.cells);
+    printf("levelc: %d blocks, %u tiles, %d collision rects\n", blocks, writer->count[LEVEL_SECTION_TILES], rects);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: levelc <source.map> <output.lvl>\n");
+        return 1;
+    }
+
+    Source source = { argv[1], fopen(argv[1], "r"), 0 };
+    if (!source.file) {
+        fprintf(stderr, "levelc: could not open %s\n", argv[1]);
+        return 1;
+    }
+
+    LevelWriter writer;
+    InitLevelWriter(&writer);
+    CompileSource(&source, &writer);
+    fclose(source.file);
+
+    uint32_t size = 0;
+    void* image = BuildLevelImage(&writer, &size);
+    UnloadLevelWriter(&writer);
+    if (!image || !SaveLevelImage(image, size, argv[2])) {
+        fprintf(stderr, "levelc: could not write %s\n", argv[2]);
+        free(image);
+        return 1;
+    }
+
+    printf("levelc: wrote %s (%u bytes)\n", argv[2], size);
+    free(image);
+    return 0;
+}
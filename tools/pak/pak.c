@@ -0,0 +1,222 @@
+// Offline asset packer: walks a directory and writes every file in it into one
+// .pak archive (src/pak_format.h) that the game maps at startup.
+//
+//   pak assets assets.pak      (run from the repository root)
+//
+// Paths are stored as walked, with '/' separators, so "assets/map/tileset.png" in
+// the game finds the file the packer read from assets/map/tileset.png.
+
+#include "pak_format.h"
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32)
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <dirent.h>
+    #include <sys/stat.h>
+#endif
+
+typedef struct PakFile {
+    char* path;
+    unsigned char* data;
+    uint32_t size;
+} PakFile;
+
+typedef struct PakList {
+    PakFile* files;
+    int count;
+    int capacity;
+} PakList;
+
+static char* CopyString(const char* text) {
+    size_t length = strlen(text) + 1;
+    char* copy = malloc(length);
+    if (copy) memcpy(copy, text, length);
+    return copy;
+}
+
+static bool AddPath(PakList* list, const char* path) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 64;
+        PakFile* files = realloc(list->files, sizeof(PakFile) * capacity);
+        if (!files) return false;
+        list->files = files;
+        list->capacity = capacity;
+    }
+    list->files[list->count] = (PakFile){ CopyString(path), NULL, 0 };
+    return list->files[list->count++].path != NULL;
+}
+
+static bool IsPakPath(const char* path) {
+    size_t length = strlen(path);
+    return length >= 4 && strcmp(path + length - 4, ".pak") == 0;
+}
+
+// Hidden files and directories (dotfiles, editor state) are left out, and so are
+// archives from an earlier run so a pak never packs itself
+static bool CollectFiles(PakList* list, const char* dir) {
+    char path[1024];
+#if defined(_WIN32)
+    snprintf(path, sizeof(path), "%s/*", dir);
+    WIN32_FIND_DATAA found;
+    HANDLE search = FindFirstFileA(path, &found);
+    if (search == INVALID_HANDLE_VALUE) return false;
+    do {
+        if (found.cFileName[0] == '.') continue;
+        snprintf(path, sizeof(path), "%s/%s", dir, found.cFileName);
+        bool ok = (found.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) ? CollectFiles(list, path) : IsPakPath(path) || AddPath(list, path);
+        if (!ok) {
+            FindClose(search);
+            return false;
+        }
+    } while (FindNextFileA(search, &found));
+    FindClose(search);
+#else
+    DIR* handle = opendir(dir);
+    if (!handle) return false;
+    for (struct dirent* found = readdir(handle); found; found = readdir(handle)) {
+        if (found->d_name[0] == '.') continue;
+        snprintf(path, sizeof(path), "%s/%s", dir, found->d_name);
+        struct stat info;
+        if (stat(path, &info) != 0) continue;
+        bool ok = S_ISDIR(info.st_mode) ? CollectFiles(list, path) : IsPakPath(path) || AddPath(list, path);
+        if (!ok) {
+            closedir(handle);
+            return false;
+        }
+    }
+    closedir(handle);
+#endif
+    return true;
+}
+
+static bool ReadWholeFile(PakFile* file) {
+    FILE* in = fopen(file->path, "rb");
+    if (!in) return false;
+    fseek(in, 0, SEEK_END);
+    long size = ftell(in);
+    fseek(in, 0, SEEK_SET);
+    if (size < 0 || (unsigned long)size > UINT32_MAX / 2) {
+        fclose(in);
+        return false;
+    }
+
+    file->data = malloc(size > 0 ? (size_t)size : 1);
+    file->size = (uint32_t)size;
+    bool ok = file->data && fread(file->data, 1, (size_t)size, in) == (size_t)size;
+    fclose(in);
+    return ok;
+}
+
+static int ComparePaths(const void* a, const void* b) {
+    return strcmp(((const PakFile*)a)->path, ((const PakFile*)b)->path);
+}
+
+static uint32_t AlignUp(uint32_t value) {
+    return (value + PAK_ALIGN - 1) & ~(uint32_t)(PAK_ALIGN - 1);
+}
+
+// Lays the whole archive out in memory, returns a malloc'd image
+static unsigned char* BuildPakImage(const PakList* list, uint32_t* size) {
+    uint32_t entryCount = (uint32_t)list->count;
+    uint32_t bucketCount = 1;
+    while (bucketCount < entryCount * 2) bucketCount *= 2;
+
+    PakHeader header = {
+        .magic = PAK_MAGIC,
+        .version = PAK_VERSION,
+        .entryCount = entryCount,
+        .bucketCount = bucketCount,
+    };
+    header.entriesOffset = sizeof(PakHeader);
+    header.bucketsOffset = header.entriesOffset + entryCount * sizeof(PakEntry);
+    header.pathsOffset = header.bucketsOffset + bucketCount * sizeof(uint32_t);
+
+    uint64_t offset = header.pathsOffset;
+    for (int i = 0; i < list->count; i++) offset += strlen(list->files[i].path) + 1;
+    for (int i = 0; i < list->count; i++) {
+        offset = AlignUp((uint32_t)offset);
+        offset += (uint64_t)list->files[i].size + 1;    // zero byte after every file
+        if (offset > UINT32_MAX - PAK_ALIGN) return NULL;
+    }
+    header.fileSize = (uint32_t)offset;
+
+    unsigned char* image = calloc(1, header.fileSize);
+    if (!image) return NULL;
+
+    PakEntry* entries = (PakEntry*)(image + header.entriesOffset);
+    uint32_t* buckets = (uint32_t*)(image + header.bucketsOffset);
+    for (uint32_t b = 0; b < bucketCount; b++) buckets[b] = PAK_EMPTY_BUCKET;
+
+    uint32_t pathCursor = header.pathsOffset;
+    uint32_t dataCursor = header.pathsOffset;
+    for (int i = 0; i < list->count; i++) dataCursor += (uint32_t)strlen(list->files[i].path) + 1;
+
+    for (uint32_t i = 0; i < entryCount; i++) {
+        const PakFile* file = &list->files[i];
+        size_t pathLength = strlen(file->path) + 1;
+        memcpy(image + pathCursor, file->path, pathLength);
+
+        dataCursor = AlignUp(dataCursor);
+        memcpy(image + dataCursor, file->data, file->size);
+
+        entries[i] = (PakEntry){ PakHashPath(file->path), pathCursor, dataCursor, file->size };
+        pathCursor += (uint32_t)pathLength;
+        dataCursor += file->size + 1;
+
+        uint32_t bucket = entries[i].hash & (bucketCount - 1);
+        while (buckets[bucket] != PAK_EMPTY_BUCKET) bucket = (bucket + 1) & (bucketCount - 1);
+        buckets[bucket] = i;
+    }
+
+    memcpy(image, &header, sizeof(header));
+    *size = header.fileSize;
+    return image;
+}
+
+int main(int argc, char** argv) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: pak <asset dir> <output.pak>\n");
+        return 1;
+    }
+
+    PakList list = {0};
+    if (!CollectFiles(&list, argv[1])) {
+        fprintf(stderr, "pak: could not read %s\n", argv[1]);
+        return 1;
+    }
+
+    // sorted so the same tree always packs to the same bytes
+    qsort(list.files, list.count, sizeof(PakFile), ComparePaths);
+
+    int status = 0;
+    for (int i = 0; i < list.count; i++) {
+        if (!ReadWholeFile(&list.files[i])) {
+            fprintf(stderr, "pak: could not read %s\n", list.files[i].path);
+            status = 1;
+        }
+    }
+
+    uint32_t size = 0;
+    unsigned char* image = status == 0 ? BuildPakImage(&list, &size) : NULL;
+    FILE* out = image ? fopen(argv[2], "wb") : NULL;
+    if (!out || fwrite(image, 1, size, out) != size) {
+        fprintf(stderr, "pak: could not write %s\n", argv[2]);
+        status = 1;
+    }
+    if (out) fclose(out);
+
+    if (status == 0) printf("pak: wrote %s (%d files, %u bytes)\n", argv[2], list.count, size);
+
+    for (int i = 0; i < list.count; i++) {
+        free(list.files[i].path);
+        free(list.files[i].data);
+    }
+    free(list.files);
+    free(image);
+    return status;
+}